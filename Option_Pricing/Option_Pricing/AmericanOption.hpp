@@ -29,6 +29,8 @@ class AmericanOption : public Option {
 private:
 	AmericanOptionData m_data;
 	double price(double S, double K, double r, double sig, double b, const Type& type) const;
+	template <typename Mesh>
+	vector<double> sweep(const Mesh& mesh, int para) const;
 public:
 	AmericanOption() : Option(), m_data(60, 65, 0.08, 0.30, 0.25) {};
 	AmericanOption(double S, double K, double r, double sig, double b) : Option(), m_data(S, K, r, sig, b) {};
@@ -38,9 +40,13 @@ public:
 
 	AmericanOption& operator = (const AmericanOption& source);
 
+	const AmericanOptionData& GetData() const { return m_data; };
+
 	double Price() const;
 	vector<double> Price(vector<double> vec, int para) const;
 	vector<vector<double>> Price(vector<vector<double>> mat, vector<int> paras) const;
+	template <typename Mesh> vector<double> Price(const Mesh& mesh, int para) const { return sweep(mesh, para); };
+	template <typename Mesh> vector<vector<double>> Price(const vector<Mesh>& meshes, const vector<int>& paras) const;
 };
 
 inline AmericanOption& AmericanOption::operator = (const AmericanOption& source) {
@@ -50,4 +56,26 @@ inline AmericanOption& AmericanOption::operator = (const AmericanOption& source)
 	return *this;
 };
 
+// sweep one pricing parameter {0 : S, 1 : K, 2 : r, 3 : sig, 4 : b} over a mesh range without materializing it
+template <typename Mesh>
+inline vector<double> AmericanOption::sweep(const Mesh& mesh, int para) const {
+	vector<double> result(mesh.size());
+	double v[5] = { m_data.m_S, m_data.m_K, m_data.m_r, m_data.m_sig, m_data.m_b };
+	if (para < 0 || para > 4) return result;
+	for (size_t i = 0; i < result.size(); i++) {
+		v[para] = mesh[i];
+		result[i] = price(v[0], v[1], v[2], v[3], v[4], m_type);
+	}
+	return result;
+}
+
+template <typename Mesh>
+inline vector<vector<double>> AmericanOption::Price(const vector<Mesh>& meshes, const vector<int>& paras) const {
+	vector<vector<double>> result;
+	for (int i = 0; i < (int)paras.size(); i++) {
+		result.push_back(Price(meshes[i], paras[i]));
+	}
+	return result;
+}
+
 #endif
\ No newline at end of file
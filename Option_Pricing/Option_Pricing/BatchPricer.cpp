@@ -0,0 +1,72 @@
+#include "BatchPricer.hpp"
+
+void BatchPrice(const EuropeanOptionData* data, const Type* types, size_t n, double* out) {
+	for (size_t i = 0; i < n; i++) {
+		const EuropeanOptionData& d = data[i];
+		out[i] = BsPrice(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b, (types[i] == Type::call) ? 1.0 : (-1.0));
+	}
+}
+
+void BatchDelta(const EuropeanOptionData* data, const Type* types, size_t n, double* out) {
+	for (size_t i = 0; i < n; i++) {
+		const EuropeanOptionData& d = data[i];
+		out[i] = BsDelta(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b, (types[i] == Type::call) ? 1.0 : (-1.0));
+	}
+}
+
+void BatchGamma(const EuropeanOptionData* data, size_t n, double* out) {
+	for (size_t i = 0; i < n; i++) {
+		const EuropeanOptionData& d = data[i];
+		out[i] = BsGamma(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b);
+	}
+}
+
+void BatchVega(const EuropeanOptionData* data, size_t n, double* out) {
+	for (size_t i = 0; i < n; i++) {
+		const EuropeanOptionData& d = data[i];
+		out[i] = BsVega(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b);
+	}
+}
+
+void BatchPrice(const AmericanOptionData* data, const Type* types, size_t n, double* out) {
+	for (size_t i = 0; i < n; i++) {
+		const AmericanOptionData& d = data[i];
+		out[i] = PerpetualPrice(d.m_S, d.m_K, d.m_r, d.m_sig, d.m_b, (types[i] == Type::call) ? 1.0 : (-1.0));
+	}
+}
+
+void BatchPrice(const EuropeanOptionData* data, const Type& type, size_t n, double* out) {
+	double id = (type == Type::call) ? 1.0 : (-1.0);
+	for (size_t i = 0; i < n; i++) {
+		const EuropeanOptionData& d = data[i];
+		out[i] = BsPrice(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b, id);
+	}
+}
+
+void BatchDelta(const EuropeanOptionData* data, const Type& type, size_t n, double* out) {
+	double id = (type == Type::call) ? 1.0 : (-1.0);
+	for (size_t i = 0; i < n; i++) {
+		const EuropeanOptionData& d = data[i];
+		out[i] = BsDelta(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b, id);
+	}
+}
+
+void BatchPrice(const AmericanOptionData* data, const Type& type, size_t n, double* out) {
+	double id = (type == Type::call) ? 1.0 : (-1.0);
+	for (size_t i = 0; i < n; i++) {
+		const AmericanOptionData& d = data[i];
+		out[i] = PerpetualPrice(d.m_S, d.m_K, d.m_r, d.m_sig, d.m_b, id);
+	}
+}
+
+vector<double> BatchPrice(const vector<EuropeanOptionData>& data, const vector<Type>& types) {
+	vector<double> result(data.size());
+	BatchPrice(data.data(), types.data(), data.size(), result.data());
+	return result;
+}
+
+vector<double> BatchPrice(const vector<AmericanOptionData>& data, const vector<Type>& types) {
+	vector<double> result(data.size());
+	BatchPrice(data.data(), types.data(), data.size(), result.data());
+	return result;
+}
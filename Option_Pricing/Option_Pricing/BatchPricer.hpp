@@ -0,0 +1,78 @@
+#ifndef BatchPricer_HPP
+#define BatchPricer_HPP
+
+#include <cmath>
+#include <vector>
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+
+using namespace std;
+
+// Batch kernels: one tight, branch-free loop per Greek over a whole batch of contracts.
+// The normal cdf/pdf go through erfc/exp instead of the boost distribution, whose argument
+// checks cost more than the formula itself. The loops call log/exp/erfc, so they run scalar.
+
+inline double NormalCdf(double x) {
+	return 0.5 * erfc(-x * 0.70710678118654752440);
+}
+
+inline double NormalPdf(double x) {
+	return 0.39894228040143267794 * exp(-0.5 * x * x);
+}
+
+// Closed-form kernels for one contract, shared by the batch loops and the compact records.
+// id = +1 for a call, -1 for a put.
+inline double BsPrice(double S, double K, double T, double r, double sig, double b, double id) {
+	double sigSqrtT = sig * sqrt(T);
+	double d1 = (log(S / K) + (b + 0.5 * sig * sig) * T) / sigSqrtT;
+	double d2 = d1 - sigSqrtT;
+	return id * (S * exp((b - r) * T) * NormalCdf(id * d1) - K * exp(-r * T) * NormalCdf(id * d2));
+}
+
+inline double BsDelta(double S, double K, double T, double r, double sig, double b, double id) {
+	double d1 = (log(S / K) + (b + 0.5 * sig * sig) * T) / (sig * sqrt(T));
+	return id * exp((b - r) * T) * NormalCdf(id * d1);
+}
+
+inline double BsGamma(double S, double K, double T, double r, double sig, double b) {
+	double sigSqrtT = sig * sqrt(T);
+	double d1 = (log(S / K) + (b + 0.5 * sig * sig) * T) / sigSqrtT;
+	return NormalPdf(d1) * exp((b - r) * T) / (S * sigSqrtT);
+}
+
+inline double BsVega(double S, double K, double T, double r, double sig, double b) {
+	double sqrtT = sqrt(T);
+	double d1 = (log(S / K) + (b + 0.5 * sig * sig) * T) / (sig * sqrtT);
+	return S * sqrtT * exp((b - r) * T) * NormalPdf(d1);
+}
+
+inline double BsTheta(double S, double K, double T, double r, double sig, double b, double id) {
+	double sqrtT = sqrt(T);
+	double d1 = (log(S / K) + (b + 0.5 * sig * sig) * T) / (sig * sqrtT);
+	double d2 = d1 - sig * sqrtT;
+	// same form as EuropeanOption::Theta()
+	return -S * sig * exp((b - r) * T) * NormalPdf(d1) / (2 * sqrtT) - (b - r) * S * exp((b - r) * T) * NormalCdf(d1) - id * r * K * exp(-r * T) * NormalCdf(id * d2);
+}
+
+// perpetual American option, as AmericanOption::Price()
+inline double PerpetualPrice(double S, double K, double r, double sig, double b, double id) {
+	double sig2 = sig * sig;
+	double y = 0.5 - b / sig2 + id * sqrt(pow((b / sig2 - 0.5), 2) + 2 * r / sig2);
+	return id * K / (y - 1) * pow((y - 1) / y * S / K, y);
+}
+
+void BatchPrice(const EuropeanOptionData* data, const Type* types, size_t n, double* out);
+void BatchDelta(const EuropeanOptionData* data, const Type* types, size_t n, double* out);
+void BatchGamma(const EuropeanOptionData* data, size_t n, double* out);
+void BatchVega(const EuropeanOptionData* data, size_t n, double* out);
+void BatchPrice(const AmericanOptionData* data, const Type* types, size_t n, double* out);
+
+// same kernels for a batch that shares one option type, so the call/put sign is loop invariant
+void BatchPrice(const EuropeanOptionData* data, const Type& type, size_t n, double* out);
+void BatchDelta(const EuropeanOptionData* data, const Type& type, size_t n, double* out);
+void BatchPrice(const AmericanOptionData* data, const Type& type, size_t n, double* out);
+
+vector<double> BatchPrice(const vector<EuropeanOptionData>& data, const vector<Type>& types);
+vector<double> BatchPrice(const vector<AmericanOptionData>& data, const vector<Type>& types);
+
+#endif
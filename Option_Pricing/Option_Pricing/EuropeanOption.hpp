@@ -32,6 +32,16 @@ private:
 	double gamma(double S, double K, double T, double r, double sig, double b, const Type& type) const;
 	double approx_delta(double h, double S, double K, double T, double r, double sig, double b, const Type& type) const;
 	double approx_gamma(double h, double S, double K, double T, double r, double sig, double b, const Type& type) const;
+	typedef double (EuropeanOption::*Formula)(double S, double K, double T, double r, double sig, double b, const Type& type) const;
+	typedef double (EuropeanOption::*ApproxFormula)(double h, double S, double K, double T, double r, double sig, double b, const Type& type) const;
+	template <typename Mesh>
+	vector<double> sweep(Formula f, const Mesh& mesh, int para) const;
+	template <typename Mesh>
+	vector<double> sweep(ApproxFormula f, double h, const Mesh& mesh, int para) const;
+	template <typename Mesh>
+	vector<vector<double>> sweep(Formula f, const vector<Mesh>& meshes, const vector<int>& paras) const;
+	template <typename Mesh>
+	vector<vector<double>> sweep(ApproxFormula f, double h, const vector<Mesh>& meshes, const vector<int>& paras) const;
 public:
 	EuropeanOption() : Option(), m_data(60,65,0.25,0.08,0.30,0.25) {};
 	EuropeanOption(double S, double K, double T, double r, double sig, double b) : Option(), m_data(S, K, T, r, sig, b) {};
@@ -43,9 +53,13 @@ public:
 	
 	EuropeanOption& operator = (const EuropeanOption& source);
 
+	const EuropeanOptionData& GetData() const { return m_data; };
+
 	double Price() const;
 	vector<double> Price(const vector<double>& vec, int para) const;
 	vector<vector<double>> Price(const vector<vector<double>>& mat, const vector<int>& paras) const;
+	template <typename Mesh> vector<double> Price(const Mesh& mesh, int para) const { return sweep(&EuropeanOption::price, mesh, para); };
+	template <typename Mesh> vector<vector<double>> Price(const vector<Mesh>& meshes, const vector<int>& paras) const { return sweep(&EuropeanOption::price, meshes, paras); };
 	
 	double Delta() const;
 	double ApproxDelta(double h) const;
@@ -53,6 +67,10 @@ public:
 	vector<double> ApproxDelta(double h, const vector<double>& vec, int para) const;
 	vector<vector<double>> Delta(const vector<vector<double>>& mat, const vector<int>& paras) const;
 	vector<vector<double>> ApproxDelta(double h, const vector<vector<double>>& mat, const vector<int>& paras) const;
+	template <typename Mesh> vector<double> Delta(const Mesh& mesh, int para) const { return sweep(&EuropeanOption::delta, mesh, para); };
+	template <typename Mesh> vector<double> ApproxDelta(double h, const Mesh& mesh, int para) const { return sweep(&EuropeanOption::approx_delta, h, mesh, para); };
+	template <typename Mesh> vector<vector<double>> Delta(const vector<Mesh>& meshes, const vector<int>& paras) const { return sweep(&EuropeanOption::delta, meshes, paras); };
+	template <typename Mesh> vector<vector<double>> ApproxDelta(double h, const vector<Mesh>& meshes, const vector<int>& paras) const { return sweep(&EuropeanOption::approx_delta, h, meshes, paras); };
 
 	double Gamma() const;
 	double ApproxGamma(double h) const;
@@ -60,6 +78,10 @@ public:
 	vector<double> ApproxGamma(double h, const vector<double>& vec, int para) const;
 	vector<vector<double>> Gamma(const vector<vector<double>>& mat, const vector<int>& paras) const;
 	vector<vector<double>> ApproxGamma(double h, const vector<vector<double>>& mat, const vector<int>& paras) const;
+	template <typename Mesh> vector<double> Gamma(const Mesh& mesh, int para) const { return sweep(&EuropeanOption::gamma, mesh, para); };
+	template <typename Mesh> vector<double> ApproxGamma(double h, const Mesh& mesh, int para) const { return sweep(&EuropeanOption::approx_gamma, h, mesh, para); };
+	template <typename Mesh> vector<vector<double>> Gamma(const vector<Mesh>& meshes, const vector<int>& paras) const { return sweep(&EuropeanOption::gamma, meshes, paras); };
+	template <typename Mesh> vector<vector<double>> ApproxGamma(double h, const vector<Mesh>& meshes, const vector<int>& paras) const { return sweep(&EuropeanOption::approx_gamma, h, meshes, paras); };
 	
 	double Vega()  const;
 	
@@ -80,4 +102,50 @@ inline EuropeanOption& EuropeanOption::operator = (const EuropeanOption& source)
 	return *this;
 }
 
+// sweep one pricing parameter {0 : S, 1 : K, 2 : T, 3 : r, 4 : sig, 5 : b} over a mesh range,
+// reading each point by index so the mesh itself never has to be materialized
+template <typename Mesh>
+inline vector<double> EuropeanOption::sweep(Formula f, const Mesh& mesh, int para) const {
+	vector<double> result(mesh.size());
+	double v[6] = { m_data.m_S, m_data.m_K, m_data.m_T, m_data.m_r, m_data.m_sig, m_data.m_b };
+	if (para < 0 || para > 5) return result;
+	for (size_t i = 0; i < result.size(); i++) {
+		v[para] = mesh[i];
+		result[i] = (this->*f)(v[0], v[1], v[2], v[3], v[4], v[5], m_type);
+	}
+	return result;
+}
+
+// same sweep for the finite-difference formulas, which take the bump size h first
+template <typename Mesh>
+inline vector<double> EuropeanOption::sweep(ApproxFormula f, double h, const Mesh& mesh, int para) const {
+	vector<double> result(mesh.size());
+	double v[6] = { m_data.m_S, m_data.m_K, m_data.m_T, m_data.m_r, m_data.m_sig, m_data.m_b };
+	if (para < 0 || para > 5) return result;
+	for (size_t i = 0; i < result.size(); i++) {
+		v[para] = mesh[i];
+		result[i] = (this->*f)(h, v[0], v[1], v[2], v[3], v[4], v[5], m_type);
+	}
+	return result;
+}
+
+// one sweep per (mesh, parameter) pair
+template <typename Mesh>
+inline vector<vector<double>> EuropeanOption::sweep(Formula f, const vector<Mesh>& meshes, const vector<int>& paras) const {
+	vector<vector<double>> result;
+	for (int i = 0; i < (int)paras.size(); i++) {
+		result.push_back(sweep(f, meshes[i], paras[i]));
+	}
+	return result;
+}
+
+template <typename Mesh>
+inline vector<vector<double>> EuropeanOption::sweep(ApproxFormula f, double h, const vector<Mesh>& meshes, const vector<int>& paras) const {
+	vector<vector<double>> result;
+	for (int i = 0; i < (int)paras.size(); i++) {
+		result.push_back(sweep(f, h, meshes[i], paras[i]));
+	}
+	return result;
+}
+
 #endif
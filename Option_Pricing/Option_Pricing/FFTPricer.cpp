@@ -0,0 +1,129 @@
+#include "FFTPricer.hpp"
+#include <cmath>
+
+const double PI = 3.14159265358979323846;
+
+complex<double> BlackScholesCF::operator () (const complex<double>& u) const {
+	double mean = log(m_data.m_S) + (m_data.m_b - 0.5 * m_data.m_sig * m_data.m_sig) * m_data.m_T;
+	double var = m_data.m_sig * m_data.m_sig * m_data.m_T;
+	// exp(i u mean - var u^2 / 2) with u = a + i c, in real arithmetic
+	double a = u.real(), c = u.imag();
+	double re = -c * mean - 0.5 * var * (a * a - c * c);
+	double im = a * mean - var * a * c;
+	return polar(exp(re), im);
+}
+
+double BlackScholesCF::Discount() const {
+	return exp(-m_data.m_r * m_data.m_T);
+}
+
+FFTPricer::FFTPricer() : FFTPricer(4096, 0.25, 1.5) {}
+
+FFTPricer::FFTPricer(size_t n, double eta, double alpha) : m_n(n), m_eta(eta), m_alpha(alpha) {
+	if ((n < 4) || ((n & (n - 1)) != 0) || (eta <= 0.0) || (alpha <= 0.0)) {
+		throw ImproperOptionDataException();
+	}
+	for (size_t k = 0; k < n / 2; k++) {
+		m_twiddle.push_back(polar(1.0, -2.0 * PI * k / n));
+	}
+}
+
+// in-place iterative radix-2 decimation in time: data[k] <- sum_j data[j] e^(-2 pi i j k / n)
+void FFTPricer::fft(vector<complex<double>>& data) const {
+	size_t n = data.size();
+	for (size_t i = 1, j = 0; i < n; i++) {
+		size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1) {
+			j ^= bit;
+		}
+		j ^= bit;
+		if (i < j) swap(data[i], data[j]);
+	}
+	for (size_t len = 2; len <= n; len <<= 1) {
+		size_t half = len / 2, stride = n / len;
+		for (size_t start = 0; start < n; start += len) {
+			for (size_t k = 0; k < half; k++) {
+				// complex product written out: operator * checks for inf/nan on some compilers
+				const complex<double>& w = m_twiddle[k * stride];
+				const complex<double>& d = data[start + k + half];
+				complex<double> t(w.real() * d.real() - w.imag() * d.imag(), w.real() * d.imag() + w.imag() * d.real());
+				data[start + k + half] = data[start + k] - t;
+				data[start + k] += t;
+			}
+		}
+	}
+}
+
+vector<double> FFTPricer::Calls(const CharacteristicFunction& cf, vector<double>& strikes) const {
+	const complex<double> i(0.0, 1.0);
+	double lambda = 2.0 * PI / (m_n * m_eta);		// log-strike spacing
+	double logF = log(real(cf(complex<double>(0.0, -1.0))));	// phi(-i) = E[S_T] = F
+	double k0 = logF - 0.5 * m_n * lambda;
+	double D = cf.Discount();
+
+	vector<complex<double>> x(m_n);
+	double peak = 0.0;
+	int negligible = 0;
+	for (size_t j = 0; j < m_n; j++) {
+		double v = j * m_eta;
+		double simpson = (j == 0) ? 1.0 / 3.0 : ((j % 2 == 1) ? 4.0 / 3.0 : 2.0 / 3.0);
+		// x_j = e^(-i v k0) D phi(u) eta w_j / (alpha^2 + alpha - v^2 + i (2 alpha + 1) v)
+		complex<double> phi = cf(complex<double>(v, -(m_alpha + 1.0)));
+		double re = m_alpha * m_alpha + m_alpha - v * v, im = (2.0 * m_alpha + 1.0) * v;
+		double scale = D * m_eta * simpson / (re * re + im * im);
+		double c = cos(v * k0), s = -sin(v * k0);
+		double pr = phi.real() * re + phi.imag() * im, pi = phi.imag() * re - phi.real() * im;	// phi * conj(denominator)
+		x[j] = complex<double>((c * pr - s * pi) * scale, (c * pi + s * pr) * scale);
+
+		// the rest of the integrand is below double precision once it has stayed there for a while
+		double size = abs(x[j].real()) + abs(x[j].imag());
+		peak = max(peak, size);
+		negligible = (size < 1e-17 * peak) ? negligible + 1 : 0;
+		if (negligible == 16) break;
+	}
+	fft(x);
+
+	// e^(-alpha k) and K = e^k along the grid by recurrence
+	vector<double> calls(m_n);
+	strikes.resize(m_n);
+	double damping = exp(-m_alpha * k0) / PI, dampingStep = exp(-m_alpha * lambda);
+	double K = exp(k0), KStep = exp(lambda);
+	for (size_t u = 0; u < m_n; u++) {
+		if (u % 64 == 0) { // refresh to keep the recurrence error at a few ulps
+			damping = exp(-m_alpha * (k0 + u * lambda)) / PI;
+			K = exp(k0 + u * lambda);
+		}
+		strikes[u] = K;
+		calls[u] = damping * real(x[u]);
+		damping *= dampingStep;
+		K *= KStep;
+	}
+	return calls;
+}
+
+vector<double> FFTPricer::Price(const CharacteristicFunction& cf, const vector<double>& strikes, const Type& type) const {
+	vector<double> grid;
+	vector<double> calls = Calls(cf, grid);
+	double k0 = log(grid[0]);
+	double lambda = 2.0 * PI / (m_n * m_eta);
+	double F = real(cf(complex<double>(0.0, -1.0)));
+	double D = cf.Discount();
+
+	vector<double> result(strikes.size());
+	for (size_t s = 0; s < strikes.size(); s++) {
+		if ((strikes[s] <= grid[1]) || (strikes[s] >= grid[m_n - 2])) {
+			throw ImproperOptionDataException(); // outside the grid
+		}
+		// 4-point Lagrange interpolation in log strike around the requested strike
+		double t = (log(strikes[s]) - k0) / lambda;
+		size_t j = (size_t)t - 1;
+		j = (j + 3 >= m_n) ? m_n - 4 : j;
+		double x = t - j;	// in [1, 2)
+		double c = -calls[j] * (x - 1.0) * (x - 2.0) * (x - 3.0) / 6.0
+			+ calls[j + 1] * x * (x - 2.0) * (x - 3.0) / 2.0
+			- calls[j + 2] * x * (x - 1.0) * (x - 3.0) / 2.0
+			+ calls[j + 3] * x * (x - 1.0) * (x - 2.0) / 6.0;
+		result[s] = (type == Type::call) ? c : c - D * (F - strikes[s]);
+	}
+	return result;
+}
@@ -0,0 +1,55 @@
+#ifndef FFTPricer_HPP
+#define FFTPricer_HPP
+
+#include <vector>
+#include <complex>
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+// Model dynamics seen through the characteristic function of the log price at maturity,
+// phi(u) = E[exp(i u log(S_T))] under the pricing measure. Any model with a known phi
+// (Heston, Merton jumps, variance gamma, ...) can be priced by deriving from this class.
+class CharacteristicFunction {
+public:
+	virtual ~CharacteristicFunction() {};
+	virtual complex<double> operator () (const complex<double>& u) const = 0;
+	virtual double Discount() const = 0;	// e^(-rT)
+};
+
+// Black-Scholes dynamics of EuropeanOptionData: log(S_T) ~ N(log(S) + (b - sig^2 / 2) T, sig^2 T)
+class BlackScholesCF : public CharacteristicFunction {
+private:
+	EuropeanOptionData m_data;
+public:
+	BlackScholesCF(const EuropeanOptionData& data) : m_data(data) {};
+	virtual ~BlackScholesCF() {};
+
+	virtual complex<double> operator () (const complex<double>& u) const;
+	virtual double Discount() const;
+};
+
+// Carr-Madan FFT pricer: one FFT of size m_n gives the call prices on a whole grid of log
+// strikes, spaced 2 pi / (m_n m_eta) and centred on the log forward; requested strikes are
+// read off the grid by cubic interpolation in log strike and puts follow by parity. The
+// damping factor m_alpha keeps the transform of the call price integrable.
+class FFTPricer {
+private:
+	size_t m_n;			// FFT size, a power of 2
+	double m_eta;		// spacing of the integration grid in frequency
+	double m_alpha;		// damping factor
+	vector<complex<double>> m_twiddle;	// e^(-2 pi i k / n), k < n / 2
+
+	void fft(vector<complex<double>>& data) const;
+public:
+	FFTPricer();
+	FFTPricer(size_t n, double eta, double alpha);
+	virtual ~FFTPricer() {};
+
+	// call prices on the native log-strike grid; the grid strikes are returned in strikes
+	vector<double> Calls(const CharacteristicFunction& cf, vector<double>& strikes) const;
+	// prices at arbitrary strikes inside the grid
+	vector<double> Price(const CharacteristicFunction& cf, const vector<double>& strikes, const Type& type) const;
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef FiniteDifference_HPP
+#define FiniteDifference_HPP
+
+#include <vector>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// Adaptive finite-difference Greeks with Richardson extrapolation.
+// The first step is chosen from the parameter scale and machine epsilon, halved at every
+// level, and the central differences are extrapolated in a Neville tableau until two
+// successive estimates agree to tol (relative to max(1, |value|)) or round-off starts to
+// dominate. Works with any option class that offers the sweep Price(vector<double>, para),
+// e.g. EuropeanOption and AmericanOption, whether or not it has analytic Greeks.
+
+struct FDResult {
+	double m_value;		// extrapolated derivative
+	double m_error;		// error estimate from the tableau
+	int m_evaluations;	// number of option prices computed
+};
+
+// derivative of the given order (1 or 2) of a sweep function f(vector<double>) -> vector<double> at x
+template <typename F>
+FDResult AdaptiveDerivative(F f, double x, int order, double tol) {
+	const int LEVELS = 8;
+	double eps = numeric_limits<double>::epsilon();
+	double scale = max(abs(x), 1.0);
+	// eps^(1/(order+2)) is the round-off optimal step of a plain central difference; start
+	// 2^(LEVELS-2) times larger and let the extrapolation remove the truncation error
+	double h = scale * pow(eps, 1.0 / (order + 2)) * pow(2.0, LEVELS - 2);
+	// a positive x is usually a parameter that must stay positive (S, T, sig): keep x - h above
+	// zero, e.g. the gamma-sized step of a 0.5% volatility would otherwise bump it negative
+	if (x > 0.0) h = min(h, 0.5 * x);
+
+	FDResult best;
+	best.m_value = 0.0;
+	best.m_error = numeric_limits<double>::max();
+	best.m_evaluations = 0;
+	double centre = 0.0;
+	if (order == 2) {
+		centre = f(vector<double>(1, x))[0];
+		best.m_evaluations++;
+	}
+
+	double tableau[LEVELS][LEVELS];
+	vector<double> points(2);
+	for (int i = 0; i < LEVELS; i++, h /= 2.0) {
+		points[0] = x + h;
+		points[1] = x - h;
+		vector<double> V = f(points);
+		best.m_evaluations += 2;
+		tableau[i][0] = (order == 1) ? (V[0] - V[1]) / (2.0 * h) : (V[0] - 2.0 * centre + V[1]) / (h * h);
+
+		double factor = 1.0;
+		for (int j = 1; j <= i; j++) {
+			factor *= 4.0; // central differences: error expansion in even powers of h
+			tableau[i][j] = tableau[i][j - 1] + (tableau[i][j - 1] - tableau[i - 1][j - 1]) / (factor - 1.0);
+			double err = max(abs(tableau[i][j] - tableau[i][j - 1]), abs(tableau[i][j] - tableau[i - 1][j - 1]));
+			if (err <= best.m_error) {
+				best.m_value = tableau[i][j];
+				best.m_error = err;
+			}
+		}
+		if (i == 0) {
+			best.m_value = tableau[0][0];
+		}
+		else {
+			if (best.m_error <= tol * max(1.0, abs(best.m_value))) break;
+			// the diagonal moving away again means round-off has taken over
+			if (abs(tableau[i][i] - tableau[i - 1][i - 1]) >= 2.0 * best.m_error) break;
+		}
+	}
+	return best;
+}
+
+// sweep function bumping one pricing parameter of an option
+template <typename O>
+class Bump {
+private:
+	const O& m_option;
+	int m_para;
+public:
+	Bump(const O& option, int para) : m_option(option), m_para(para) {};
+	vector<double> operator () (const vector<double>& points) const { return m_option.Price(points, m_para); };
+};
+
+template <typename O>
+FDResult AdaptiveDelta(const O& option, double tol) {
+	return AdaptiveDerivative(Bump<O>(option, 0), option.GetData().m_S, 1, tol);
+}
+
+template <typename O>
+FDResult AdaptiveGamma(const O& option, double tol) {
+	return AdaptiveDerivative(Bump<O>(option, 0), option.GetData().m_S, 2, tol);
+}
+
+#endif
@@ -0,0 +1,138 @@
+#include "HedgeSimulator.hpp"
+#include "BatchPricer.hpp"
+#include "RiskStats.hpp"
+#include <cmath>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+const size_t BLOCK = 256;	// paths simulated side by side
+
+// per-step terms shared by all paths
+struct HedgeSimulator::Schedule {
+	vector<double> m_shift;		// (b + sig^2 / 2) tau - log(K), so d1 = (log(S) + shift) * inv
+	vector<double> m_inv;		// 1 / (sig sqrt(tau))
+	vector<double> m_carry;		// e^((b-r) tau)
+	double m_stepDrift;			// (mu - sigReal^2 / 2) dt
+	double m_stepVol;			// sigReal sqrt(dt)
+	double m_growth;			// e^(r dt) on the cash account
+	double m_dividend;			// e^((r-b) dt) - 1 paid on the stock held
+	double m_premium;			// Black-Scholes value received for the option
+};
+
+HedgeSimulator::HedgeSimulator(const EuropeanOption& option, double mu, double sigReal)
+	: m_data(option.GetData()), m_type(option.GetType()), m_mu(mu), m_sigReal(sigReal), m_steps(252), m_rebalance(1), m_cost(0.0), m_alpha(0.95), m_threads(0) {
+	if (sigReal <= 0.0) {
+		throw ImproperOptionDataException();
+	}
+}
+
+void HedgeSimulator::Steps(int steps, int rebalance) {
+	if ((steps <= 0) || (rebalance <= 0)) {
+		throw ImproperOptionDataException();
+	}
+	m_steps = steps;
+	m_rebalance = rebalance;
+}
+
+void HedgeSimulator::simulate(const Schedule& schedule, size_t block, size_t paths, unsigned seed, double* pnl, double* cost) const {
+	// one generator per block: the same paths whatever the thread count
+	seed_seq sequence = { seed, (unsigned)block };
+	mt19937_64 gen(sequence);
+	normal_distribution<double> normal(0.0, 1.0);
+	double put = (m_type == Type::call) ? 0.0 : 1.0;
+	double S0 = m_data.m_S;
+	double logS0 = log(S0);
+
+	double logS[BLOCK], S[BLOCK], shares[BLOCK], cash[BLOCK], paid[BLOCK], z[BLOCK];
+	double delta0 = schedule.m_carry[0] * (NormalCdf((logS0 + schedule.m_shift[0]) * schedule.m_inv[0]) - put);
+	for (size_t i = 0; i < paths; i++) {
+		logS[i] = logS0;
+		S[i] = S0;
+		shares[i] = delta0;
+		paid[i] = m_cost * abs(delta0) * S0;
+		cash[i] = schedule.m_premium - delta0 * S0 - paid[i];
+	}
+
+	for (int j = 1; j <= m_steps; j++) {
+		for (size_t i = 0; i < paths; i++) {
+			z[i] = normal(gen);
+		}
+		for (size_t i = 0; i < paths; i++) {
+			logS[i] += schedule.m_stepDrift + schedule.m_stepVol * z[i];
+			S[i] = exp(logS[i]);
+			cash[i] = cash[i] * schedule.m_growth + shares[i] * S[i] * schedule.m_dividend;
+		}
+		if ((j < m_steps) && (j % m_rebalance == 0)) {
+			double shift = schedule.m_shift[j], inv = schedule.m_inv[j], carry = schedule.m_carry[j];
+			for (size_t i = 0; i < paths; i++) {
+				double delta = carry * (NormalCdf((logS[i] + shift) * inv) - put);
+				double trade = delta - shares[i];
+				double c = m_cost * abs(trade) * S[i];
+				cash[i] -= trade * S[i] + c;
+				paid[i] += c;
+				shares[i] = delta;
+			}
+		}
+	}
+
+	// settle: pay the option, unwind the hedge
+	double id = (m_type == Type::call) ? 1.0 : (-1.0);
+	for (size_t i = 0; i < paths; i++) {
+		double c = m_cost * abs(shares[i]) * S[i];
+		pnl[i] = cash[i] + shares[i] * S[i] - c - max(id * (S[i] - m_data.m_K), 0.0);
+		cost[i] = paid[i] + c;
+	}
+}
+
+HedgeResult HedgeSimulator::Run(size_t paths, unsigned seed) const {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	double dt = m_data.m_T / m_steps;
+	Schedule schedule;
+	for (int j = 0; j < m_steps; j++) {
+		double tau = m_data.m_T - j * dt;
+		schedule.m_shift.push_back((m_data.m_b + 0.5 * m_data.m_sig * m_data.m_sig) * tau - log(m_data.m_K));
+		schedule.m_inv.push_back(1.0 / (m_data.m_sig * sqrt(tau)));
+		schedule.m_carry.push_back(exp((m_data.m_b - m_data.m_r) * tau));
+	}
+	schedule.m_stepDrift = (m_mu - 0.5 * m_sigReal * m_sigReal) * dt;
+	schedule.m_stepVol = m_sigReal * sqrt(dt);
+	schedule.m_growth = exp(m_data.m_r * dt);
+	schedule.m_dividend = exp((m_data.m_r - m_data.m_b) * dt) - 1.0;
+	schedule.m_premium = EuropeanOption(m_data, m_type).Price();
+
+	HedgeResult result;
+	result.m_pnl.resize(paths);
+	vector<double> cost(paths);
+	size_t blocks = (paths + BLOCK - 1) / BLOCK;
+	size_t threads = (m_threads > 0) ? m_threads : max(1u, thread::hardware_concurrency());
+	threads = max((size_t)1, min(threads, blocks));
+	vector<thread> workers;
+	for (size_t t = 0; t < threads; t++) {
+		workers.push_back(thread([this, &schedule, &result, &cost, paths, seed, blocks, t, threads]() {
+			for (size_t k = t; k < blocks; k += threads) {
+				size_t begin = k * BLOCK;
+				simulate(schedule, k, min(BLOCK, paths - begin), seed, &result.m_pnl[begin], &cost[begin]);
+			}
+		}));
+	}
+	for (size_t t = 0; t < threads; t++) {
+		workers[t].join();
+	}
+
+	double sum = 0.0, sum2 = 0.0, costSum = 0.0;
+	for (size_t i = 0; i < paths; i++) {
+		sum += result.m_pnl[i];
+		sum2 += result.m_pnl[i] * result.m_pnl[i];
+		costSum += cost[i];
+	}
+	result.m_mean = (paths > 0) ? sum / paths : 0.0;
+	result.m_stdev = (paths > 1) ? sqrt(max(0.0, (sum2 - paths * result.m_mean * result.m_mean) / (paths - 1))) : 0.0;
+	result.m_meanCost = (paths > 0) ? costSum / paths : 0.0;
+	result.m_VaR = VaR(result.m_pnl, m_alpha);
+	result.m_ES = ES(result.m_pnl, m_alpha);
+	result.m_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	result.m_pathStepsPerSecond = (double)paths * m_steps / result.m_seconds;
+	return result;
+}
@@ -0,0 +1,55 @@
+#ifndef HedgeSimulator_HPP
+#define HedgeSimulator_HPP
+
+#include <vector>
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+// P&L of the hedged short position at maturity, over all paths
+struct HedgeResult {
+	vector<double> m_pnl;	// one entry per path
+	double m_mean;
+	double m_stdev;
+	double m_VaR;			// at the simulator's confidence level, as a positive loss
+	double m_ES;
+	double m_meanCost;		// average transaction cost paid per path
+	double m_seconds;		// wall-clock time of the run
+	double m_pathStepsPerSecond;
+};
+
+// Delta-hedging backtest: sell the option at its Black-Scholes price, hold Delta() shares,
+// rebalance every m_rebalance steps paying m_cost per unit of traded notional, and settle at
+// maturity. The spot follows a geometric Brownian motion with real-world drift m_mu and
+// realized volatility m_sigReal, which may differ from the implied volatility of the option.
+// Every term that only depends on the time left (sqrt(tau), sig sqrt(tau), e^((b-r) tau), the
+// d1 drift) is computed once per step for all paths. Paths run in blocks of 256 in structure
+// of arrays layout, each block with its own generator seeded from (seed, block), so the
+// result does not depend on the number of threads.
+class HedgeSimulator {
+private:
+	EuropeanOptionData m_data;
+	Type m_type;
+	double m_mu;		// real-world drift of the spot
+	double m_sigReal;	// realized volatility of the spot
+	int m_steps;		// time steps to maturity
+	int m_rebalance;	// rebalance every this many steps
+	double m_cost;		// proportional transaction cost
+	double m_alpha;		// confidence level of VaR and ES
+	int m_threads;		// 0: use hardware concurrency
+
+	struct Schedule;
+	void simulate(const Schedule& schedule, size_t block, size_t paths, unsigned seed, double* pnl, double* cost) const;
+public:
+	HedgeSimulator(const EuropeanOption& option, double mu, double sigReal);
+	virtual ~HedgeSimulator() {};
+
+	void Steps(int steps, int rebalance);
+	void Cost(double cost) { m_cost = cost; };
+	void Confidence(double alpha) { m_alpha = alpha; };
+	void Threads(int threads) { m_threads = threads; };
+
+	HedgeResult Run(size_t paths, unsigned seed) const;
+};
+
+#endif
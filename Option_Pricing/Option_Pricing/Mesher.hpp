@@ -2,17 +2,105 @@
 #define Mesher_HPP
 
 #include <vector>
+#include <cmath>
+#include <cstddef>
 using namespace std;
 
-vector<double> Mesher(double begin, double end, double h) {
-	int n = (int) ((end - begin) / h) + 1; // exception
-	n = (n < 0) ? 1 : n;
-	vector<double> mesh(n);
-	mesh[0] = begin;
-	for (int i = 1; i < n; i++) { // exception
-		mesh[i] = mesh[i - 1] + h;
+// Lazy mesh ranges: each point is computed from its index, so nothing is allocated and no
+// rounding error builds up along the mesh. They work with the sweep functions of the option
+// classes (Price(mesh, para), Delta(mesh, para), ...) as well as in range-for loops.
+
+template <typename Mesh>
+class MeshIterator {
+private:
+	const Mesh* m_mesh;
+	size_t m_i;
+public:
+	MeshIterator(const Mesh* mesh, size_t i) : m_mesh(mesh), m_i(i) {};
+	double operator * () const { return (*m_mesh)[m_i]; };
+	MeshIterator& operator ++ () { m_i++; return *this; };
+	bool operator != (const MeshIterator& other) const { return m_i != other.m_i; };
+};
+
+// begin, begin + h, ..., up to end: the same points as Mesher()
+class UniformMesh {
+private:
+	double m_begin;
+	double m_h;
+	size_t m_n;
+public:
+	UniformMesh(double begin, double end, double h) : m_begin(begin), m_h(h) {
+		// the tolerance keeps an end point a whole number of steps away that the division
+		// lands just below, e.g. (0.30 - 0.20) / 0.01 = 9.9999999999999982
+		double steps = floor((end - begin) / h + 1e-9);
+		m_n = (steps < 0.0) ? 1 : (size_t)steps + 1;
+	};
+	size_t size() const { return m_n; };
+	double operator [] (size_t i) const { return m_begin + i * m_h; };
+	MeshIterator<UniformMesh> begin() const { return MeshIterator<UniformMesh>(this, 0); };
+	MeshIterator<UniformMesh> end() const { return MeshIterator<UniformMesh>(this, m_n); };
+};
+
+// n points spaced evenly in log between begin and end (both positive)
+class LogMesh {
+private:
+	double m_begin;
+	double m_logStep;
+	size_t m_n;
+public:
+	LogMesh(double begin, double end, size_t n) : m_begin(begin), m_n(n) {
+		m_logStep = (n > 1) ? log(end / begin) / (n - 1) : 0.0;
+	};
+	size_t size() const { return m_n; };
+	double operator [] (size_t i) const { return m_begin * exp(i * m_logStep); };
+	MeshIterator<LogMesh> begin() const { return MeshIterator<LogMesh>(this, 0); };
+	MeshIterator<LogMesh> end() const { return MeshIterator<LogMesh>(this, m_n); };
+};
+
+// n Chebyshev nodes of [begin, end], in increasing order
+class ChebyshevMesh {
+private:
+	double m_mid;
+	double m_half;
+	size_t m_n;
+public:
+	ChebyshevMesh(double begin, double end, size_t n) : m_mid(0.5 * (begin + end)), m_half(0.5 * (end - begin)), m_n(n) {};
+	size_t size() const { return m_n; };
+	double operator [] (size_t i) const { return m_mid - m_half * cos(3.14159265358979323846 * (2.0 * i + 1.0) / (2.0 * m_n)); };
+	MeshIterator<ChebyshevMesh> begin() const { return MeshIterator<ChebyshevMesh>(this, 0); };
+	MeshIterator<ChebyshevMesh> end() const { return MeshIterator<ChebyshevMesh>(this, m_n); };
+};
+
+// n points from begin to end clustered around the strike K with a sinh stretching;
+// a smaller width concentrates more points near K
+class StrikeMesh {
+private:
+	double m_K;
+	double m_width;
+	double m_c1;
+	double m_c2;
+	size_t m_n;
+public:
+	StrikeMesh(double begin, double end, double K, double width, size_t n) : m_K(K), m_width(width), m_n(n) {
+		m_c1 = asinh((begin - K) / width);
+		m_c2 = asinh((end - K) / width);
+	};
+	size_t size() const { return m_n; };
+	double operator [] (size_t i) const {
+		double u = (m_n > 1) ? (double)i / (m_n - 1) : 0.0;
+		return m_K + m_width * sinh(m_c1 + u * (m_c2 - m_c1));
+	};
+	MeshIterator<StrikeMesh> begin() const { return MeshIterator<StrikeMesh>(this, 0); };
+	MeshIterator<StrikeMesh> end() const { return MeshIterator<StrikeMesh>(this, m_n); };
+};
+
+inline vector<double> Mesher(double begin, double end, double h) {
+	UniformMesh range(begin, end, h);
+	vector<double> mesh(range.size());
+	for (size_t i = 0; i < mesh.size(); i++) {
+		mesh[i] = range[i];
 	}
 	return mesh;
 }
 
-#endif
\ No newline at end of file
+#endif
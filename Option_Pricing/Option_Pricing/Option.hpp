@@ -25,6 +25,7 @@ public:
 	Option& operator = (const Option& source);
 
 	void toggle() { m_type = (m_type == Type::call) ? Type::put : Type::call; };
+	const Type& GetType() const { return m_type; };
 	// string ToString() const;
 
 	virtual double Price() const = 0;
@@ -0,0 +1,112 @@
+#include "OptionChain.hpp"
+#include "BatchPricer.hpp"
+#include <cmath>
+
+OptionChain::OptionChain(double S, double r, double b) : m_r(r), m_b(b) {
+	if (S <= 0.0) {
+		throw ImproperOptionDataException();
+	}
+	m_S = S;
+	m_logS = log(S);
+}
+
+void OptionChain::update(Expiry& expiry) {
+	expiry.m_sqrtT = sqrt(expiry.m_T);
+	expiry.m_sigSqrtT = expiry.m_sig * expiry.m_sqrtT;
+	expiry.m_df = exp(-m_r * expiry.m_T);
+	expiry.m_carry = exp((m_b - m_r) * expiry.m_T);
+	expiry.m_drift = (m_b + 0.5 * expiry.m_sig * expiry.m_sig) * expiry.m_T;
+}
+
+size_t OptionChain::AddExpiry(double T, double sig, const vector<double>& strikes) {
+	if ((T <= 0.0) || (sig <= 0.0)) {
+		throw ImproperOptionDataException();
+	}
+	Expiry expiry;
+	expiry.m_T = T;
+	expiry.m_sig = sig;
+	for (size_t i = 0; i < strikes.size(); i++) {
+		if (strikes[i] <= 0.0) {
+			throw ImproperOptionDataException();
+		}
+		expiry.m_K.push_back(strikes[i]);
+		expiry.m_logK.push_back(log(strikes[i]));
+	}
+	update(expiry);
+	m_expiries.push_back(expiry);
+	return m_expiries.size() - 1;
+}
+
+void OptionChain::SetSpot(double S) {
+	if (S <= 0.0) {
+		throw ImproperOptionDataException();
+	}
+	m_S = S;
+	m_logS = log(S);
+}
+
+void OptionChain::SetVol(size_t expiry, double sig) {
+	if (sig <= 0.0) {
+		throw ImproperOptionDataException();
+	}
+	m_expiries[expiry].m_sig = sig;
+	update(m_expiries[expiry]);
+}
+
+void OptionChain::SetRates(double r, double b) {
+	m_r = r;
+	m_b = b;
+	for (size_t e = 0; e < m_expiries.size(); e++) {
+		update(m_expiries[e]);
+	}
+}
+
+void OptionChain::Price(size_t expiry, double* call, double* put) const {
+	const Expiry& x = m_expiries[expiry];
+	const double* K = x.m_K.data();
+	const double* logK = x.m_logK.data();
+	double forward = m_S * x.m_carry;	// S e^((b-r)T)
+	double shift = m_logS + x.m_drift;
+	double inv = 1.0 / x.m_sigSqrtT;
+	size_t n = x.m_K.size();
+	for (size_t i = 0; i < n; i++) {
+		double d1 = (shift - logK[i]) * inv;
+		double d2 = d1 - x.m_sigSqrtT;
+		double strike = K[i] * x.m_df;
+		// the put is priced directly, since parity call - forward + strike cancels to noise in the
+		// out-of-the-money wing; one cdf per d gives the smaller of N(d), N(-d), the other is 1 - it
+		double tail1 = NormalCdf(-abs(d1)), tail2 = NormalCdf(-abs(d2));
+		double up1 = (d1 < 0.0) ? tail1 : 1.0 - tail1, down1 = (d1 < 0.0) ? 1.0 - tail1 : tail1;	// N(d1), N(-d1)
+		double up2 = (d2 < 0.0) ? tail2 : 1.0 - tail2, down2 = (d2 < 0.0) ? 1.0 - tail2 : tail2;
+		call[i] = forward * up1 - strike * up2;
+		put[i] = strike * down2 - forward * down1;
+	}
+}
+
+void OptionChain::Risk(size_t expiry, double* callDelta, double* putDelta, double* gamma, double* vega) const {
+	const Expiry& x = m_expiries[expiry];
+	const double* logK = x.m_logK.data();
+	double shift = m_logS + x.m_drift;
+	double inv = 1.0 / x.m_sigSqrtT;
+	double gammaScale = x.m_carry / (m_S * x.m_sigSqrtT);
+	double vegaScale = m_S * x.m_carry * x.m_sqrtT;
+	size_t n = x.m_logK.size();
+	for (size_t i = 0; i < n; i++) {
+		double d1 = (shift - logK[i]) * inv;
+		double pdf = NormalPdf(d1);
+		callDelta[i] = x.m_carry * NormalCdf(d1);
+		putDelta[i] = callDelta[i] - x.m_carry;
+		gamma[i] = gammaScale * pdf;
+		vega[i] = vegaScale * pdf;
+	}
+}
+
+void OptionChain::Price(vector<vector<double>>& call, vector<vector<double>>& put) const {
+	call.resize(m_expiries.size());
+	put.resize(m_expiries.size());
+	for (size_t e = 0; e < m_expiries.size(); e++) {
+		call[e].resize(m_expiries[e].m_K.size());
+		put[e].resize(m_expiries[e].m_K.size());
+		Price(e, call[e].data(), put[e].data());
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef OptionChain_HPP
+#define OptionChain_HPP
+
+#include <vector>
+#include <cstddef>
+#include "ImproperOptionDataException.hpp"
+
+using namespace std;
+
+// Listed options on one underlying, strikes grouped by expiry. The terms every strike of an
+// expiry shares (sqrt(T), sig sqrt(T), e^(-rT), e^((b-r)T) and the d1 drift) are kept per
+// expiry and log(K) per strike, so a pass over an expiry only needs log(S), one subtraction, one
+// multiplication by 1 / (sig sqrt(T)) and two normal cdfs per strike, shared by the call and the put.
+// SetSpot() touches nothing else, SetVol() refreshes a single expiry.
+class OptionChain {
+private:
+	struct Expiry {
+		double m_T;			// exercise (maturity) date
+		double m_sig;		// constant volatility of the expiry
+		double m_sqrtT;
+		double m_sigSqrtT;
+		double m_df;		// e^(-rT)
+		double m_carry;		// e^((b-r)T)
+		double m_drift;		// (b + sig^2 / 2) T
+		vector<double> m_K;
+		vector<double> m_logK;
+	};
+	double m_S;		// asset price
+	double m_logS;
+	double m_r;		// risk-free interest rate
+	double m_b;		// cost of carry
+	vector<Expiry> m_expiries;
+
+	void update(Expiry& expiry);
+public:
+	OptionChain(double S, double r, double b);
+	virtual ~OptionChain() {};
+
+	// adds an expiry with its strikes and returns its index
+	size_t AddExpiry(double T, double sig, const vector<double>& strikes);
+
+	void SetSpot(double S);
+	void SetVol(size_t expiry, double sig);
+	void SetRates(double r, double b);
+
+	size_t Expiries() const { return m_expiries.size(); };
+	size_t Strikes(size_t expiry) const { return m_expiries[expiry].m_K.size(); };
+	double GetT(size_t expiry) const { return m_expiries[expiry].m_T; };
+	const vector<double>& GetStrikes(size_t expiry) const { return m_expiries[expiry].m_K; };
+
+	// call and put price of every strike of one expiry, output arrays of Strikes(expiry)
+	void Price(size_t expiry, double* call, double* put) const;
+	// call delta, put delta, gamma and vega of every strike of one expiry
+	void Risk(size_t expiry, double* callDelta, double* putDelta, double* gamma, double* vega) const;
+	// the whole chain, one vector per expiry
+	void Price(vector<vector<double>>& call, vector<vector<double>>& put) const;
+};
+
+#endif
@@ -0,0 +1,26 @@
+#include "OptionSnapshot.hpp"
+
+shared_ptr<const OptionSnapshot> OptionSnapshot::Toggled() const {
+	return make_shared<const OptionSnapshot>(m_data, (m_type == Type::call) ? Type::put : Type::call);
+}
+
+// a const EuropeanOption on the stack: pricing never touches shared mutable state
+double OptionSnapshot::Price() const {
+	return EuropeanOption(m_data, m_type).Price();
+}
+
+double OptionSnapshot::Delta() const {
+	return EuropeanOption(m_data, m_type).Delta();
+}
+
+double OptionSnapshot::Gamma() const {
+	return EuropeanOption(m_data, m_type).Gamma();
+}
+
+double OptionSnapshot::Vega() const {
+	return EuropeanOption(m_data, m_type).Vega();
+}
+
+double OptionSnapshot::Theta() const {
+	return EuropeanOption(m_data, m_type).Theta();
+}
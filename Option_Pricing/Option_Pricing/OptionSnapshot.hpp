@@ -0,0 +1,88 @@
+#ifndef OptionSnapshot_HPP
+#define OptionSnapshot_HPP
+
+#include <memory>
+#include <atomic>
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+// Immutable option data and type. Unlike EuropeanOption (toggle(), operator =) nothing can
+// change after construction, so one snapshot can be priced from any number of threads
+// without a lock; a different type or market is a new snapshot.
+class OptionSnapshot {
+private:
+	const EuropeanOptionData m_data;
+	const Type m_type;
+public:
+	OptionSnapshot(const EuropeanOptionData& data, const Type& type) : m_data(data), m_type(type) {};
+	OptionSnapshot(const OptionSnapshot& source) = delete;
+	virtual ~OptionSnapshot() {};
+
+	OptionSnapshot& operator = (const OptionSnapshot& source) = delete;
+
+	const EuropeanOptionData& GetData() const { return m_data; };
+	const Type& GetType() const { return m_type; };
+
+	// the same contract with the other type, in place of toggle()
+	shared_ptr<const OptionSnapshot> Toggled() const;
+
+	double Price() const;
+	double Delta() const;
+	double Gamma() const;
+	double Vega() const;
+	double Theta() const;
+};
+
+// Publishes the current snapshot to reader threads, RCU style: a writer builds a new snapshot
+// and swaps it in with atomic_store(), readers take a reference with atomic_load(), and the
+// old snapshot is freed when its last reader lets go of it. The shared_ptr atomics are not
+// lock-free: libstdc++ takes a mutex from a small pool keyed by address, MSVC a global
+// spinlock. That lock covers the pointer and reference count update only, never the
+// building or pricing of a snapshot.
+class SnapshotPublisher {
+private:
+	shared_ptr<const OptionSnapshot> m_current;
+	atomic<unsigned long long> m_version;	// bumped after every swap
+public:
+	SnapshotPublisher(const EuropeanOptionData& data, const Type& type) : m_current(make_shared<const OptionSnapshot>(data, type)), m_version(0) {};
+	SnapshotPublisher(const SnapshotPublisher& source) = delete;
+	virtual ~SnapshotPublisher() {};
+
+	SnapshotPublisher& operator = (const SnapshotPublisher& source) = delete;
+
+	shared_ptr<const OptionSnapshot> Load() const { return atomic_load(&m_current); };
+	unsigned long long Version() const { return m_version.load(memory_order_acquire); };
+
+	void Publish(const shared_ptr<const OptionSnapshot>& snapshot) {
+		atomic_store(&m_current, snapshot);
+		m_version.fetch_add(1, memory_order_release);
+	};
+	void Publish(const EuropeanOptionData& data, const Type& type) { Publish(make_shared<const OptionSnapshot>(data, type)); };
+};
+
+// Per-thread view of a publisher. It keeps its own reference to the last snapshot and only
+// goes back to the publisher (and its lock) when the version has moved, so a read is one
+// lock-free atomic load of the version in the steady state. Not to be shared between threads.
+class SnapshotReader {
+private:
+	const SnapshotPublisher& m_publisher;
+	shared_ptr<const OptionSnapshot> m_local;
+	unsigned long long m_version;
+public:
+	SnapshotReader(const SnapshotPublisher& publisher) : m_publisher(publisher), m_version(publisher.Version()) {
+		m_local = publisher.Load();
+	};
+	virtual ~SnapshotReader() {};
+
+	const OptionSnapshot& Get() {
+		unsigned long long version = m_publisher.Version();
+		if (version != m_version) {
+			m_version = version;
+			m_local = m_publisher.Load();	// at least as new as version
+		}
+		return *m_local;
+	};
+};
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef OptionStore_HPP
+#define OptionStore_HPP
+
+#include <vector>
+#include <cstdint>
+#include "EuropeanOption.hpp"
+#include "BatchPricer.hpp"
+
+using namespace std;
+
+// Compact European option record: no vtable, no separate enum. S and K stay double; the
+// non-price fields T, r, sig, b are stored as Real (double, or float for the compact mode).
+// The option type is packed into the sign bit of K, which validated data keeps positive.
+// Packed to 48 bytes with Real = double (4 records per 3 cache lines) and 32 bytes with
+// Real = float (2 per line); the chunks, not the records, carry the cache-line alignment.
+template <typename Real>
+struct CompactOption {
+	double m_S;
+	double m_K;		// negative for a put
+	Real m_T;
+	Real m_r;
+	Real m_sig;
+	Real m_b;
+};
+
+// Lightweight handle to a record in an OptionStore, exposing the EuropeanOption pricing interface.
+template <typename Real>
+class OptionHandle {
+private:
+	const CompactOption<Real>* m_record;
+public:
+	OptionHandle(const CompactOption<Real>* record) : m_record(record) {};
+
+	Type GetType() const { return (m_record->m_K < 0.0) ? Type::put : Type::call; };
+	EuropeanOptionData GetData() const;
+
+	double Price() const;
+	double Delta() const;
+	double Gamma() const;
+	double Vega() const;
+	double Theta() const;
+};
+
+// Arena of CompactOption records. Records live in fixed-size, cache-line aligned chunks that
+// are never reallocated, so handles stay valid while the store grows; Clear() releases
+// the whole book at once.
+template <typename Real>
+class OptionStore {
+private:
+	static const size_t CHUNK = 4096;	// records per chunk
+	static const size_t ALIGN = 64;		// cache line
+	vector<char*> m_chunks;				// raw allocations, m_records[i] points into m_chunks[i]
+	vector<CompactOption<Real>*> m_records;
+	size_t m_size;
+
+	CompactOption<Real>* next();
+public:
+	OptionStore() : m_size(0) {};
+	OptionStore(const OptionStore& source) = delete;
+	virtual ~OptionStore() { Clear(); };
+
+	OptionStore& operator = (const OptionStore& source) = delete;
+
+	size_t Add(const EuropeanOptionData& data, const Type& type);
+	size_t Add(const vector<EuropeanOptionData>& data, const vector<Type>& types);	// returns index of the first record
+	void Clear();
+	size_t Size() const { return m_size; };
+	size_t Bytes() const { return m_chunks.size() * (CHUNK * sizeof(CompactOption<Real>) + ALIGN); };
+
+	OptionHandle<Real> operator [] (size_t i) const { return OptionHandle<Real>(&m_records[i / CHUNK][i % CHUNK]); };
+
+	vector<double> Price() const;
+};
+
+template <typename Real>
+const size_t OptionStore<Real>::CHUNK;
+
+template <typename Real>
+const size_t OptionStore<Real>::ALIGN;
+
+template <typename Real>
+inline EuropeanOptionData OptionHandle<Real>::GetData() const {
+	return EuropeanOptionData(m_record->m_S, abs(m_record->m_K), m_record->m_T, m_record->m_r, m_record->m_sig, m_record->m_b);
+}
+
+template <typename Real>
+inline double OptionHandle<Real>::Price() const {
+	const CompactOption<Real>& d = *m_record;
+	return BsPrice(d.m_S, abs(d.m_K), d.m_T, d.m_r, d.m_sig, d.m_b, (d.m_K < 0.0) ? (-1.0) : 1.0);
+}
+
+template <typename Real>
+inline double OptionHandle<Real>::Delta() const {
+	const CompactOption<Real>& d = *m_record;
+	return BsDelta(d.m_S, abs(d.m_K), d.m_T, d.m_r, d.m_sig, d.m_b, (d.m_K < 0.0) ? (-1.0) : 1.0);
+}
+
+template <typename Real>
+inline double OptionHandle<Real>::Gamma() const {
+	const CompactOption<Real>& d = *m_record;
+	return BsGamma(d.m_S, abs(d.m_K), d.m_T, d.m_r, d.m_sig, d.m_b);
+}
+
+template <typename Real>
+inline double OptionHandle<Real>::Vega() const {
+	const CompactOption<Real>& d = *m_record;
+	return BsVega(d.m_S, abs(d.m_K), d.m_T, d.m_r, d.m_sig, d.m_b);
+}
+
+template <typename Real>
+inline double OptionHandle<Real>::Theta() const {
+	const CompactOption<Real>& d = *m_record;
+	return BsTheta(d.m_S, abs(d.m_K), d.m_T, d.m_r, d.m_sig, d.m_b, (d.m_K < 0.0) ? (-1.0) : 1.0);
+}
+
+template <typename Real>
+inline CompactOption<Real>* OptionStore<Real>::next() {
+	if (m_size == m_records.size() * CHUNK) {
+		char* raw = new char[CHUNK * sizeof(CompactOption<Real>) + ALIGN];
+		uintptr_t aligned = ((uintptr_t)raw + ALIGN - 1) & ~(uintptr_t)(ALIGN - 1);
+		m_chunks.push_back(raw);
+		m_records.push_back((CompactOption<Real>*)aligned);
+	}
+	CompactOption<Real>* record = &m_records[m_size / CHUNK][m_size % CHUNK];
+	m_size++;
+	return record;
+}
+
+template <typename Real>
+inline size_t OptionStore<Real>::Add(const EuropeanOptionData& data, const Type& type) {
+	CompactOption<Real>* record = next();
+	record->m_S = data.m_S;
+	record->m_K = (type == Type::call) ? data.m_K : -data.m_K;
+	record->m_T = (Real)data.m_T;
+	record->m_r = (Real)data.m_r;
+	record->m_sig = (Real)data.m_sig;
+	record->m_b = (Real)data.m_b;
+	return m_size - 1;
+}
+
+template <typename Real>
+inline size_t OptionStore<Real>::Add(const vector<EuropeanOptionData>& data, const vector<Type>& types) {
+	size_t first = m_size;
+	for (size_t i = 0; i < data.size(); i++) {
+		Add(data[i], types[i]);
+	}
+	return first;
+}
+
+template <typename Real>
+inline void OptionStore<Real>::Clear() {
+	for (size_t i = 0; i < m_chunks.size(); i++) {
+		delete[] m_chunks[i];
+	}
+	m_chunks.clear();
+	m_records.clear();
+	m_size = 0;
+}
+
+template <typename Real>
+inline vector<double> OptionStore<Real>::Price() const {
+	vector<double> result(m_size);
+	for (size_t c = 0; c < m_records.size(); c++) {
+		size_t n = min(CHUNK, m_size - c * CHUNK);
+		const CompactOption<Real>* records = m_records[c];
+		double* out = &result[c * CHUNK];
+		for (size_t i = 0; i < n; i++) {
+			out[i] = OptionHandle<Real>(&records[i]).Price();
+		}
+	}
+	return result;
+}
+
+#endif
@@ -0,0 +1,95 @@
+#include "ParityScanner.hpp"
+#include <cmath>
+#include <algorithm>
+#include <thread>
+
+void OptionChainQuotes::Add(const ParityQuote& quote) {
+	m_K.push_back(quote.m_K);
+	m_T.push_back(quote.m_T);
+	m_callBid.push_back(quote.m_callBid);
+	m_callAsk.push_back(quote.m_callAsk);
+	m_putBid.push_back(quote.m_putBid);
+	m_putAsk.push_back(quote.m_putAsk);
+}
+
+// mid-price residual per quote and, when edge is given, what the parity trade still makes after
+// crossing the spread. Each expiry is found and its two exponentials computed before its strikes
+// are touched, so the residual loops are branch-free over the columns and can be vectorized.
+void ParityScanner::residuals(const OptionChainQuotes& chain, vector<double>& mid, vector<double>* edge) const {
+	size_t n = chain.Size();
+	mid.resize(n);
+	if (edge) edge->resize(n);
+	const double* K = chain.m_K.data();
+	const double* T = chain.m_T.data();
+	const double* callBid = chain.m_callBid.data();
+	const double* callAsk = chain.m_callAsk.data();
+	const double* putBid = chain.m_putBid.data();
+	const double* putAsk = chain.m_putAsk.data();
+	double* res = mid.data();
+	double* out = edge ? edge->data() : NULL;
+
+	for (size_t first = 0, last = 0; first < n; first = last) {
+		while ((last < n) && (T[last] == T[first])) last++;
+		double df = exp(-chain.m_r * T[first]);
+		double fwd = chain.m_S * exp((chain.m_b - chain.m_r) * T[first]);
+		for (size_t i = first; i < last; i++) {
+			res[i] = 0.5 * (callBid[i] + callAsk[i]) - 0.5 * (putBid[i] + putAsk[i]) - (fwd - K[i] * df);
+		}
+		if (out) {
+			for (size_t i = first; i < last; i++) {
+				double parity = fwd - K[i] * df;
+				out[i] = max(callBid[i] - putAsk[i] - parity, parity - (callAsk[i] - putBid[i]));
+			}
+		}
+	}
+}
+
+void ParityScanner::scan(const OptionChainQuotes& chain, size_t index, vector<double>& mid, vector<double>& edge, vector<ParityViolation>& out) const {
+	residuals(chain, mid, m_useSpread ? &edge : NULL);
+	for (size_t i = 0; i < mid.size(); i++) {
+		double test = m_useSpread ? edge[i] : abs(mid[i]);
+		if (test > m_tol) {
+			ParityViolation v;
+			v.m_chain = index;
+			v.m_quote = i;
+			v.m_residual = mid[i];
+			out.push_back(v);
+		}
+	}
+}
+
+vector<double> ParityScanner::Residuals(const OptionChainQuotes& chain) const {
+	vector<double> result;
+	residuals(chain, result, NULL);
+	return result;
+}
+
+vector<ParityViolation> ParityScanner::Scan(const OptionChainQuotes& chain) const {
+	vector<double> mid, edge;
+	vector<ParityViolation> result;
+	scan(chain, 0, mid, edge, result);
+	return result;
+}
+
+vector<ParityViolation> ParityScanner::Scan(const vector<OptionChainQuotes>& chains) const {
+	size_t threads = (m_threads > 0) ? m_threads : max(1u, thread::hardware_concurrency());
+	threads = max((size_t)1, min(threads, chains.size()));
+	// underlyings are independent: each thread scans a contiguous range into its own list
+	vector<vector<ParityViolation>> found(threads);
+	vector<thread> workers;
+	size_t per = (chains.size() + threads - 1) / threads;
+	for (size_t t = 0; t < threads; t++) {
+		workers.push_back(thread([this, &chains, &found, t, per]() {
+			vector<double> mid, edge;
+			for (size_t c = t * per; c < min(chains.size(), (t + 1) * per); c++) {
+				scan(chains[c], c, mid, edge, found[t]);
+			}
+		}));
+	}
+	vector<ParityViolation> result;
+	for (size_t t = 0; t < threads; t++) {
+		workers[t].join();
+		result.insert(result.end(), found[t].begin(), found[t].end());
+	}
+	return result;
+}
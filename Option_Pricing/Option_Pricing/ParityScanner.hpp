@@ -0,0 +1,70 @@
+#ifndef ParityScanner_HPP
+#define ParityScanner_HPP
+
+#include <vector>
+#include <cstddef>
+
+using namespace std;
+
+// one strike of a chain: call and put quotes for the same K and T
+struct ParityQuote {
+	double m_K;			// strike price
+	double m_T;			// exercise (maturity) date
+	double m_callBid;
+	double m_callAsk;
+	double m_putBid;
+	double m_putAsk;
+	ParityQuote(double K, double T, double callBid, double callAsk, double putBid, double putAsk)
+		: m_K(K), m_T(T), m_callBid(callBid), m_callAsk(callAsk), m_putBid(putBid), m_putAsk(putAsk) {};
+	// single traded price for each leg: bid = ask
+	ParityQuote(double K, double T, double call, double put)
+		: m_K(K), m_T(T), m_callBid(call), m_callAsk(call), m_putBid(put), m_putAsk(put) {};
+};
+
+// all quotes on one underlying, sorted by expiry so the discount factors of an expiry are computed
+// once; stored by column so the residual loops stream through contiguous arrays
+struct OptionChainQuotes {
+	double m_S;		// asset price
+	double m_r;		// risk-free interest rate
+	double m_b;		// cost of carry
+	vector<double> m_K;
+	vector<double> m_T;
+	vector<double> m_callBid;
+	vector<double> m_callAsk;
+	vector<double> m_putBid;
+	vector<double> m_putAsk;
+
+	void Add(const ParityQuote& quote);
+	size_t Size() const { return m_K.size(); };
+	ParityQuote operator [] (size_t i) const { return ParityQuote(m_K[i], m_T[i], m_callBid[i], m_callAsk[i], m_putBid[i], m_putAsk[i]); };
+};
+
+struct ParityViolation {
+	size_t m_chain;		// index of the underlying in the scanned vector
+	size_t m_quote;		// index of the quote in its chain
+	double m_residual;	// C - P - (S e^((b-r)T) - K e^(-rT)), using mid prices
+};
+
+// Put-call parity C - P = S e^((b-r)T) - K e^(-rT), checked on quotes without any pricing call.
+// A quote is flagged when the residual exceeds tol; with useSpread the residual must also
+// survive crossing the spread, i.e. the trade (buy the cheap side at the ask, sell the rich
+// side at the bid) must still make more than tol.
+class ParityScanner {
+private:
+	double m_tol;
+	bool m_useSpread;
+	int m_threads;		// 0: use hardware concurrency
+
+	void residuals(const OptionChainQuotes& chain, vector<double>& mid, vector<double>* edge) const;
+	void scan(const OptionChainQuotes& chain, size_t index, vector<double>& mid, vector<double>& edge, vector<ParityViolation>& out) const;
+public:
+	ParityScanner(double tol) : m_tol(tol), m_useSpread(false), m_threads(0) {};
+	ParityScanner(double tol, bool useSpread, int threads) : m_tol(tol), m_useSpread(useSpread), m_threads(threads) {};
+	virtual ~ParityScanner() {};
+
+	vector<double> Residuals(const OptionChainQuotes& chain) const;
+	vector<ParityViolation> Scan(const OptionChainQuotes& chain) const;
+	vector<ParityViolation> Scan(const vector<OptionChainQuotes>& chains) const;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include "Portfolio.hpp"
+#include "BatchPricer.hpp"
+
+size_t Portfolio::Add(const EuropeanOption& option) {
+	Group<EuropeanOptionData>& group = m_european[slot(option.GetType())];
+	group.m_data.push_back(option.GetData());
+	group.m_index.push_back(m_size);
+	return m_size++;
+}
+
+size_t Portfolio::Add(const AmericanOption& option) {
+	Group<AmericanOptionData>& group = m_american[slot(option.GetType())];
+	group.m_data.push_back(option.GetData());
+	group.m_index.push_back(m_size);
+	return m_size++;
+}
+
+void Portfolio::Clear() {
+	for (int i = 0; i < 2; i++) {
+		m_european[i].m_data.clear(); m_european[i].m_index.clear();
+		m_american[i].m_data.clear(); m_american[i].m_index.clear();
+	}
+	m_size = 0;
+}
+
+vector<double> Portfolio::Price() const {
+	vector<double> result(m_size);
+	vector<double> prices;
+	for (int i = 0; i < 2; i++) {
+		Type type = (i == 1) ? Type::call : Type::put;
+
+		const Group<EuropeanOptionData>& european = m_european[i];
+		prices.resize(european.m_data.size());
+		BatchPrice(european.m_data.data(), type, prices.size(), prices.data());
+		for (size_t j = 0; j < prices.size(); j++) {
+			result[european.m_index[j]] = prices[j];
+		}
+
+		const Group<AmericanOptionData>& american = m_american[i];
+		prices.resize(american.m_data.size());
+		BatchPrice(american.m_data.data(), type, prices.size(), prices.data());
+		for (size_t j = 0; j < prices.size(); j++) {
+			result[american.m_index[j]] = prices[j];
+		}
+	}
+	return result;
+}
+
+double Portfolio::Value(const vector<double>& quantities) const {
+	vector<double> prices = Price();
+	double value = 0.0;
+	for (size_t i = 0; i < prices.size() && i < quantities.size(); i++) {
+		value += quantities[i] * prices[i];
+	}
+	return value;
+}
@@ -0,0 +1,38 @@
+#ifndef Portfolio_HPP
+#define Portfolio_HPP
+
+#include <vector>
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+
+using namespace std;
+
+// Mixed book of European and American options. Contracts are stored grouped by concrete
+// class and option type, each group is priced with one batch kernel call instead of one
+// virtual Price() call per contract, and results come back in the order of Add().
+class Portfolio {
+private:
+	template <typename Data>
+	struct Group {
+		vector<Data> m_data;
+		vector<size_t> m_index;	// position of each contract in the caller's order
+	};
+	Group<EuropeanOptionData> m_european[2];	// [0] put, [1] call
+	Group<AmericanOptionData> m_american[2];
+	size_t m_size;
+
+	static int slot(const Type& type) { return (type == Type::call) ? 1 : 0; };
+public:
+	Portfolio() : m_size(0) {};
+	virtual ~Portfolio() {};
+
+	size_t Add(const EuropeanOption& option);
+	size_t Add(const AmericanOption& option);
+	void Clear();
+	size_t Size() const { return m_size; };
+
+	vector<double> Price() const;
+	double Value(const vector<double>& quantities) const;
+};
+
+#endif
@@ -0,0 +1,173 @@
+#include "PricingCache.hpp"
+#include <cstring>
+
+static uint64_t bits(double x) {
+	uint64_t b;
+	memcpy(&b, &x, sizeof(b));
+	return b;
+}
+
+bool PricingCache::Key::operator == (const Key& other) const {
+	return memcmp(m_bits, other.m_bits, sizeof(m_bits)) == 0 && m_tag == other.m_tag;
+}
+
+uint64_t PricingCache::hash(const Key& k) {
+	// multiply-xorshift mix of every word
+	uint64_t h = (k.m_tag + 1) * 0x9E3779B97F4A7C15ULL;
+	for (int i = 0; i < 6; i++) {
+		h ^= k.m_bits[i];
+		h *= 0xBF58476D1CE4E5B9ULL;
+		h ^= h >> 31;
+	}
+	return h;
+}
+
+PricingCache::Key PricingCache::key(const EuropeanOptionData& data, const Type& type, const Output& output) {
+	Key k = { { bits(data.m_S), bits(data.m_K), bits(data.m_T), bits(data.m_r), bits(data.m_sig), bits(data.m_b) },
+		((uint64_t)(type == Type::call) << 8) | (uint64_t)output };
+	return k;
+}
+
+PricingCache::Key PricingCache::key(const AmericanOptionData& data, const Type& type) {
+	Key k = { { bits(data.m_S), bits(data.m_K), bits(data.m_r), bits(data.m_sig), bits(data.m_b), 0 },
+		(1ULL << 9) | ((uint64_t)(type == Type::call) << 8) | (uint64_t)Output::price };
+	return k;
+}
+
+const size_t PricingCache::WAYS;
+
+PricingCache::PricingCache(size_t capacity, size_t shards) {
+	shards = (shards == 0) ? 1 : shards;
+	m_sets = (capacity + shards * WAYS - 1) / (shards * WAYS);
+	m_sets = (m_sets == 0) ? 1 : m_sets;
+	for (size_t i = 0; i < shards; i++) {
+		m_shards.push_back(unique_ptr<Shard>(new Shard()));
+		Shard& shard = *m_shards.back();
+		shard.m_fingerprints.assign(m_sets * WAYS, 0);
+		shard.m_storage.reset(new char[m_sets * WAYS * sizeof(Slot) + 64]);
+		shard.m_slots = (Slot*)(((uintptr_t)shard.m_storage.get() + 63) & ~(uintptr_t)63);
+		shard.m_referenced.assign(m_sets, 0);
+		shard.m_hands.assign(m_sets, 0);
+		m_shards.back()->m_hits = 0;
+		m_shards.back()->m_misses = 0;
+	}
+}
+
+// the shard comes from the top bits of the hash, the set from the bottom bits and the
+// fingerprint from the middle bits
+static uint32_t fingerprint(uint64_t h) {
+	uint32_t f = (uint32_t)(h >> 20);
+	return (f == 0) ? 1 : f;
+}
+
+bool PricingCache::find(const Key& k, uint64_t h, double& value) {
+	Shard& shard = *m_shards[(h >> 52) % m_shards.size()];
+	size_t s = h % m_sets;
+	size_t first = s * WAYS;
+	uint32_t f = fingerprint(h);
+	lock_guard<mutex> lock(shard.m_mutex);
+	for (size_t w = first; w < first + WAYS; w++) {
+		if (shard.m_fingerprints[w] == f && shard.m_slots[w].m_key == k) {
+			shard.m_referenced[s] |= (unsigned char)(1 << (w - first));
+			value = shard.m_slots[w].m_value;
+			shard.m_hits++;
+			return true;
+		}
+	}
+	shard.m_misses++;
+	return false;
+}
+
+void PricingCache::insert(const Key& k, uint64_t h, double value) {
+	Shard& shard = *m_shards[(h >> 52) % m_shards.size()];
+	size_t s = h % m_sets;
+	size_t first = s * WAYS;
+	uint32_t f = fingerprint(h);
+	lock_guard<mutex> lock(shard.m_mutex);
+	for (size_t w = first; w < first + WAYS; w++) {
+		if (shard.m_fingerprints[w] == f && shard.m_slots[w].m_key == k) return; // another thread computed it meanwhile
+	}
+	// CLOCK: give referenced ways a second chance, take the first one that has none; the
+	// reference bits live apart from the slots, so only the slot that is written is touched
+	unsigned char& hand = shard.m_hands[s];
+	unsigned char& referenced = shard.m_referenced[s];
+	while (shard.m_fingerprints[first + hand] != 0 && (referenced & (1 << hand))) {
+		referenced &= (unsigned char)~(1 << hand);
+		hand = (hand + 1) % WAYS;
+	}
+	referenced &= (unsigned char)~(1 << hand);
+	shard.m_fingerprints[first + hand] = f;
+	shard.m_slots[first + hand].m_key = k;
+	shard.m_slots[first + hand].m_value = value;
+	hand = (hand + 1) % WAYS;
+}
+
+double PricingCache::Get(const EuropeanOptionData& data, const Type& type, const Output& output) {
+	Key k = key(data, type, output);
+	uint64_t h = hash(k);
+	double value;
+	if (find(k, h, value)) return value;
+
+	EuropeanOption option(data, type);
+	switch (output) {
+	case Output::price: value = option.Price(); break;
+	case Output::delta: value = option.Delta(); break;
+	case Output::gamma: value = option.Gamma(); break;
+	case Output::vega: value = option.Vega(); break;
+	case Output::theta: value = option.Theta(); break;
+	}
+	insert(k, h, value);
+	return value;
+}
+
+double PricingCache::Price(const AmericanOptionData& data, const Type& type) {
+	Key k = key(data, type);
+	uint64_t h = hash(k);
+	double value;
+	if (find(k, h, value)) return value;
+
+	Type t = type;
+	value = AmericanOption(data.m_S, data.m_K, data.m_r, data.m_sig, data.m_b, t).Price();
+	insert(k, h, value);
+	return value;
+}
+
+void PricingCache::Clear() {
+	for (size_t i = 0; i < m_shards.size(); i++) {
+		lock_guard<mutex> lock(m_shards[i]->m_mutex);
+		m_shards[i]->m_fingerprints.assign(m_sets * WAYS, 0);
+		m_shards[i]->m_referenced.assign(m_sets, 0);
+		m_shards[i]->m_hands.assign(m_sets, 0);
+		m_shards[i]->m_hits = 0;
+		m_shards[i]->m_misses = 0;
+	}
+}
+
+size_t PricingCache::Size() const {
+	size_t size = 0;
+	for (size_t i = 0; i < m_shards.size(); i++) {
+		lock_guard<mutex> lock(m_shards[i]->m_mutex);
+		for (size_t j = 0; j < m_shards[i]->m_fingerprints.size(); j++) {
+			size += (m_shards[i]->m_fingerprints[j] != 0) ? 1 : 0;
+		}
+	}
+	return size;
+}
+
+long long PricingCache::Hits() const {
+	long long hits = 0;
+	for (size_t i = 0; i < m_shards.size(); i++) {
+		lock_guard<mutex> lock(m_shards[i]->m_mutex);
+		hits += m_shards[i]->m_hits;
+	}
+	return hits;
+}
+
+long long PricingCache::Misses() const {
+	long long misses = 0;
+	for (size_t i = 0; i < m_shards.size(); i++) {
+		lock_guard<mutex> lock(m_shards[i]->m_mutex);
+		misses += m_shards[i]->m_misses;
+	}
+	return misses;
+}
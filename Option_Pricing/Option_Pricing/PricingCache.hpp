@@ -0,0 +1,78 @@
+#ifndef PricingCache_HPP
+#define PricingCache_HPP
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+
+using namespace std;
+
+// what the cache returns for a contract
+enum class Output {
+	price, delta, gamma, vega, theta
+};
+
+// Bounded, sharded memo in front of the pricing and Greek functions. Entries are keyed on
+// the bit patterns of the option data fields plus type and output, so only exact repeats
+// hit (0.0 and -0.0 are different keys). Each shard has its own mutex and a fixed table of
+// 8-way sets: the key hash picks the set and a 32-bit fingerprint screens its ways. A hit
+// sets the way's reference bit, and an insertion into a full set runs CLOCK over the ways
+// (clear referenced bits, evict the first unreferenced way). Nothing is allocated after
+// construction, and the pricing math runs outside the shard lock.
+class PricingCache {
+private:
+	static const size_t WAYS = 8;
+	struct Key {
+		uint64_t m_bits[6];	// data fields, American data leaves the last word 0
+		uint64_t m_tag;		// American flag, type and output, packed
+		bool operator == (const Key& other) const;
+	};
+	struct Slot {			// 64 bytes: one cache line
+		Key m_key;
+		double m_value;
+	};
+	struct Shard {
+		mutex m_mutex;
+		vector<uint32_t> m_fingerprints;	// per slot, 0 = empty; a miss only reads these
+		unique_ptr<char[]> m_storage;	// raw allocation behind m_slots
+		Slot* m_slots;					// m_sets * WAYS slots, set by set, cache-line aligned
+		vector<unsigned char> m_referenced;	// CLOCK reference bits of each set, one per way
+		vector<unsigned char> m_hands;	// CLOCK hand of each set
+		long long m_hits;
+		long long m_misses;
+	};
+	vector<unique_ptr<Shard>> m_shards;	// separate allocations keep the shard locks apart
+	size_t m_sets;						// sets per shard
+
+	static Key key(const EuropeanOptionData& data, const Type& type, const Output& output);
+	static Key key(const AmericanOptionData& data, const Type& type);
+	static uint64_t hash(const Key& k);
+	bool find(const Key& k, uint64_t h, double& value);
+	void insert(const Key& k, uint64_t h, double value);
+public:
+	PricingCache(size_t capacity, size_t shards);
+	PricingCache(const PricingCache& source) = delete;
+	virtual ~PricingCache() {};
+
+	PricingCache& operator = (const PricingCache& source) = delete;
+
+	double Get(const EuropeanOptionData& data, const Type& type, const Output& output);
+	double Price(const EuropeanOptionData& data, const Type& type) { return Get(data, type, Output::price); };
+	double Price(const EuropeanOption& option) { return Get(option.GetData(), option.GetType(), Output::price); };
+	double Delta(const EuropeanOption& option) { return Get(option.GetData(), option.GetType(), Output::delta); };
+	double Gamma(const EuropeanOption& option) { return Get(option.GetData(), option.GetType(), Output::gamma); };
+	double Vega(const EuropeanOption& option) { return Get(option.GetData(), option.GetType(), Output::vega); };
+	double Theta(const EuropeanOption& option) { return Get(option.GetData(), option.GetType(), Output::theta); };
+	double Price(const AmericanOptionData& data, const Type& type);
+	double Price(const AmericanOption& option) { return Price(option.GetData(), option.GetType()); };
+
+	void Clear();
+	size_t Size() const;
+	long long Hits() const;
+	long long Misses() const;
+};
+
+#endif
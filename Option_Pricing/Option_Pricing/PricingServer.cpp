@@ -0,0 +1,216 @@
+#include "PricingServer.hpp"
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+typedef SOCKET socket_t;
+static void wake_socket(socket_t s) { shutdown(s, SD_BOTH); }
+static void close_socket(socket_t s) { shutdown(s, SD_BOTH); closesocket(s); }
+static void start_sockets() { WSADATA wsa; WSAStartup(MAKEWORD(2, 2), &wsa); }
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+typedef int socket_t;
+static const socket_t INVALID_SOCKET = -1;
+static void wake_socket(socket_t s) { shutdown(s, SHUT_RDWR); }
+static void close_socket(socket_t s) { shutdown(s, SHUT_RDWR); close(s); }
+static void start_sockets() {}
+#endif
+
+static const size_t REQUEST_SIZE = 7 * sizeof(double);
+
+static void no_delay(socket_t s) {
+	int flag = 1;
+	setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char*)&flag, sizeof(flag));
+}
+
+static bool send_all(socket_t s, const char* buffer, size_t size) {
+	while (size > 0) {
+		int sent = send(s, buffer, (int)size, 0);
+		if (sent <= 0) return false;
+		buffer += sent;
+		size -= sent;
+	}
+	return true;
+}
+
+static bool recv_all(socket_t s, char* buffer, size_t size) {
+	while (size > 0) {
+		int received = recv(s, buffer, (int)size, 0);
+		if (received <= 0) return false;
+		buffer += received;
+		size -= received;
+	}
+	return true;
+}
+
+PricingServer::PricingServer(PricingService& service, unsigned short port) : m_service(service), m_port(port), m_stop(false) {
+	start_sockets();
+	socket_t s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (s == INVALID_SOCKET) throw runtime_error("PricingServer: cannot create socket");
+	int flag = 1;
+	setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&flag, sizeof(flag));
+
+	sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(port);
+	if (::bind(s, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(s, SOMAXCONN) != 0) {
+		close_socket(s);
+		throw runtime_error("PricingServer: cannot listen on loopback port");
+	}
+	socklen_t len = sizeof(addr);
+	getsockname(s, (sockaddr*)&addr, &len);
+	m_port = ntohs(addr.sin_port);
+	m_listen = (intptr_t)s;
+	m_acceptor = thread(&PricingServer::accept_loop, this);
+}
+
+PricingServer::~PricingServer() {
+	m_stop = true;
+	close_socket((socket_t)m_listen);
+	m_acceptor.join();
+	{
+		// unblock the serving threads; each one closes its own socket on the way out
+		lock_guard<mutex> lock(m_mutex);
+		for (list<Connection>::iterator it = m_connections.begin(); it != m_connections.end(); ++it) {
+			if (it->m_open) wake_socket((socket_t)it->m_socket);
+		}
+	}
+	for (list<Connection>::iterator it = m_connections.begin(); it != m_connections.end(); ++it) {
+		it->m_thread.join();
+	}
+}
+
+void PricingServer::accept_loop() {
+	while (!m_stop) {
+		socket_t client = accept((socket_t)m_listen, NULL, NULL);
+		if (client == INVALID_SOCKET) {
+			if (m_stop) break;
+			// e.g. out of descriptors: back off instead of spinning until one is freed
+			this_thread::sleep_for(chrono::milliseconds(10));
+			continue;
+		}
+		no_delay(client);
+		lock_guard<mutex> lock(m_mutex);
+		// reap the connections that have been closed since the last accept
+		for (list<Connection>::iterator it = m_connections.begin(); it != m_connections.end();) {
+			if (it->m_done) {
+				it->m_thread.join();
+				it = m_connections.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+		m_connections.emplace_back((intptr_t)client);
+		Connection& connection = m_connections.back();
+		connection.m_thread = thread(&PricingServer::serve, this, &connection);
+	}
+}
+
+void PricingServer::serve(Connection* connection) {
+	socket_t client = (socket_t)connection->m_socket;
+	vector<char> buffer(REQUEST_SIZE * 1024);
+	size_t filled = 0;
+	vector<future<double>> pending;
+	vector<double> replies;
+	while (!m_stop) {
+		int received = recv(client, buffer.data() + filled, (int)(buffer.size() - filled), 0);
+		if (received <= 0) break;
+		filled += received;
+
+		// submit every complete request read so far before waiting on any of them
+		size_t count = filled / REQUEST_SIZE;
+		pending.clear();
+		for (size_t i = 0; i < count; i++) {
+			double v[7];
+			memcpy(v, buffer.data() + i * REQUEST_SIZE, REQUEST_SIZE);
+			try {
+				pending.push_back(m_service.Submit(EuropeanOptionData(v[0], v[1], v[2], v[3], v[4], v[5]), (v[6] > 0.0) ? Type::call : Type::put));
+			}
+			catch (ImproperOptionDataException&) { // improper data is answered with NaN
+				promise<double> nan;
+				nan.set_value(numeric_limits<double>::quiet_NaN());
+				pending.push_back(nan.get_future());
+			}
+		}
+		filled -= count * REQUEST_SIZE;
+		memmove(buffer.data(), buffer.data() + count * REQUEST_SIZE, filled);
+
+		replies.resize(count);
+		for (size_t i = 0; i < count; i++) {
+			replies[i] = pending[i].get();
+		}
+		if (!send_all(client, (const char*)replies.data(), count * sizeof(double))) break;
+	}
+	{
+		lock_guard<mutex> lock(m_mutex);
+		close_socket(client);
+		connection->m_open = false;
+	}
+	connection->m_done = true;
+}
+
+PricingClient::PricingClient(unsigned short port) {
+	start_sockets();
+	socket_t s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (s == INVALID_SOCKET) throw runtime_error("PricingClient: cannot create socket");
+	sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(port);
+	if (connect(s, (sockaddr*)&addr, sizeof(addr)) != 0) {
+		close_socket(s);
+		throw runtime_error("PricingClient: cannot connect to loopback port");
+	}
+	no_delay(s);
+	m_socket = (intptr_t)s;
+}
+
+PricingClient::~PricingClient() {
+	close_socket((socket_t)m_socket);
+}
+
+double PricingClient::Price(const EuropeanOptionData& data, const Type& type) {
+	double v[7] = { data.m_S, data.m_K, data.m_T, data.m_r, data.m_sig, data.m_b, (type == Type::call) ? 1.0 : (-1.0) };
+	double price;
+	if (!send_all((socket_t)m_socket, (const char*)v, REQUEST_SIZE) || !recv_all((socket_t)m_socket, (char*)&price, sizeof(price))) {
+		throw runtime_error("PricingClient: connection lost");
+	}
+	return price;
+}
+
+vector<double> PricingClient::Price(const vector<EuropeanOptionData>& data, const vector<Type>& types) {
+	// pipeline in chunks the server reads in one go, so neither side blocks on a full socket buffer
+	const size_t CHUNK = 1024;
+	vector<double> request(7 * CHUNK);
+	vector<double> result(data.size());
+	for (size_t first = 0; first < data.size(); first += CHUNK) {
+		size_t n = min(CHUNK, data.size() - first);
+		for (size_t i = 0; i < n; i++) {
+			const EuropeanOptionData& d = data[first + i];
+			double* v = &request[7 * i];
+			v[0] = d.m_S; v[1] = d.m_K; v[2] = d.m_T;
+			v[3] = d.m_r; v[4] = d.m_sig; v[5] = d.m_b;
+			v[6] = (types[first + i] == Type::call) ? 1.0 : (-1.0);
+		}
+		if (!send_all((socket_t)m_socket, (const char*)request.data(), n * REQUEST_SIZE)
+			|| !recv_all((socket_t)m_socket, (char*)(result.data() + first), n * sizeof(double))) {
+			throw runtime_error("PricingClient: connection lost");
+		}
+	}
+	return result;
+}
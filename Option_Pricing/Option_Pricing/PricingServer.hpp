@@ -0,0 +1,61 @@
+#ifndef PricingServer_HPP
+#define PricingServer_HPP
+
+#include <vector>
+#include <list>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include "PricingService.hpp"
+
+using namespace std;
+
+// Loopback (127.0.0.1) TCP front end for out-of-process clients.
+// Wire format, native byte order: each request is 7 doubles {S, K, T, r, sig, b, id}
+// with id = +1 for a call and -1 for a put; each reply is 1 double, in request order.
+// Requests pipelined on a connection are submitted together so they coalesce in the service.
+class PricingServer {
+private:
+	struct Connection {
+		intptr_t m_socket;
+		bool m_open;			// guarded by m_mutex; the serving thread closes the socket
+		atomic<bool> m_done;	// the serving thread has finished and can be joined
+		thread m_thread;
+		Connection(intptr_t socket) : m_socket(socket), m_open(true), m_done(false) {};
+	};
+	PricingService& m_service;
+	intptr_t m_listen;			// listening socket
+	unsigned short m_port;
+	atomic<bool> m_stop;
+	thread m_acceptor;
+	list<Connection> m_connections;	// live connections; finished ones are reaped on the next accept
+	mutex m_mutex;
+
+	void accept_loop();
+	void serve(Connection* connection);
+public:
+	PricingServer(PricingService& service, unsigned short port);	// port 0: any free port
+	PricingServer(const PricingServer& source) = delete;
+	virtual ~PricingServer();
+
+	PricingServer& operator = (const PricingServer& source) = delete;
+
+	unsigned short Port() const { return m_port; };
+};
+
+class PricingClient {
+private:
+	intptr_t m_socket;
+public:
+	PricingClient(unsigned short port);
+	PricingClient(const PricingClient& source) = delete;
+	virtual ~PricingClient();
+
+	PricingClient& operator = (const PricingClient& source) = delete;
+
+	double Price(const EuropeanOptionData& data, const Type& type);
+	vector<double> Price(const vector<EuropeanOptionData>& data, const vector<Type>& types);
+};
+
+#endif
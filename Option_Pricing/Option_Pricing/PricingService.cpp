@@ -0,0 +1,76 @@
+#include "PricingService.hpp"
+#include "BatchPricer.hpp"
+#include <iterator>
+
+PricingService::PricingService() : m_stop(false), m_maxBatch(256), m_window(50), m_batches(0), m_requests(0) {
+	m_worker = thread(&PricingService::run, this);
+}
+
+PricingService::PricingService(size_t maxBatch, long long windowMicros) : m_stop(false), m_maxBatch(maxBatch), m_window(windowMicros), m_batches(0), m_requests(0) {
+	m_maxBatch = (m_maxBatch == 0) ? 1 : m_maxBatch;
+	m_worker = thread(&PricingService::run, this);
+}
+
+PricingService::~PricingService() {
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+	m_worker.join(); // the worker drains whatever is still queued before it exits
+}
+
+future<double> PricingService::Submit(const EuropeanOptionData& data, const Type& type) {
+	future<double> result;
+	size_t size;
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_queue.push_back(Request(data, type));
+		result = m_queue.back().m_result.get_future();
+		size = m_queue.size();
+	}
+	// wake the worker for the first request of a window and when the batch fills up
+	if (size == 1 || size >= m_maxBatch) {
+		m_cv.notify_one();
+	}
+	return result;
+}
+
+future<double> PricingService::Submit(const EuropeanOption& option) {
+	return Submit(option.GetData(), option.GetType());
+}
+
+void PricingService::run() {
+	vector<Request> batch;
+	vector<EuropeanOptionData> data;
+	vector<Type> types;
+	vector<double> prices;
+	while (true) {
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+			if (m_queue.empty()) break; // stopped and drained
+			// coalescing window: keep collecting until the batch is full or the oldest request has waited m_window;
+			// whatever does not fit stays queued and is already due on the next pass
+			m_cv.wait_until(lock, m_queue.front().m_enqueued + m_window, [this] { return m_stop || m_queue.size() >= m_maxBatch; });
+			size_t n = min(m_queue.size(), m_maxBatch);
+			batch.assign(make_move_iterator(m_queue.begin()), make_move_iterator(m_queue.begin() + n));
+			m_queue.erase(m_queue.begin(), m_queue.begin() + n);
+		}
+
+		data.clear();
+		types.clear();
+		for (size_t i = 0; i < batch.size(); i++) {
+			data.push_back(batch[i].m_data);
+			types.push_back(batch[i].m_type);
+		}
+		prices.resize(batch.size());
+		BatchPrice(data.data(), types.data(), batch.size(), prices.data());
+		for (size_t i = 0; i < batch.size(); i++) {
+			batch[i].m_result.set_value(prices[i]);
+		}
+		m_batches++;
+		m_requests += batch.size();
+		batch.clear();
+	}
+}
@@ -0,0 +1,54 @@
+#ifndef PricingService_HPP
+#define PricingService_HPP
+
+#include <vector>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+// In-process asynchronous pricer: callers submit single contracts and get a future back,
+// a worker thread coalesces what arrives within the window of the oldest queued request
+// into one BatchPrice() call of at most m_maxBatch contracts.
+class PricingService {
+private:
+	struct Request {
+		EuropeanOptionData m_data;
+		Type m_type;
+		promise<double> m_result;
+		chrono::steady_clock::time_point m_enqueued;
+		Request(const EuropeanOptionData& data, const Type& type) : m_data(data), m_type(type), m_enqueued(chrono::steady_clock::now()) {};
+	};
+	deque<Request> m_queue;
+	mutex m_mutex;
+	condition_variable m_cv;
+	bool m_stop;
+	size_t m_maxBatch;				// flush as soon as this many requests are queued
+	chrono::microseconds m_window;	// or once the oldest request has waited this long
+	atomic<long long> m_batches;
+	atomic<long long> m_requests;
+	thread m_worker;
+
+	void run();
+public:
+	PricingService();
+	PricingService(size_t maxBatch, long long windowMicros);
+	PricingService(const PricingService& source) = delete;
+	virtual ~PricingService();
+
+	PricingService& operator = (const PricingService& source) = delete;
+
+	future<double> Submit(const EuropeanOptionData& data, const Type& type);
+	future<double> Submit(const EuropeanOption& option);
+
+	long long Batches() const { return m_batches; };
+	long long Requests() const { return m_requests; };
+};
+
+#endif
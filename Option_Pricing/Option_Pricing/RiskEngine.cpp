@@ -0,0 +1,162 @@
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include "RiskEngine.hpp"
+#include "BatchPricer.hpp"
+#include "RiskStats.hpp"
+
+// number of scenarios revalued together; a block of P&L stays in cache while every position is swept over it
+static const size_t BLOCK = 256;
+
+void RiskEngine::Add(const EuropeanOption& option, double quantity) {
+	const EuropeanOptionData& data = option.GetData();
+	Position pos;
+	pos.m_S = data.m_S; pos.m_K = data.m_K; pos.m_T = data.m_T;
+	pos.m_r = data.m_r; pos.m_sig = data.m_sig; pos.m_b = data.m_b;
+	pos.m_id = (option.GetType() == Type::call) ? 1.0 : (-1.0);
+	pos.m_qty = quantity;
+	pos.m_value = option.Price();
+	pos.m_logSK = log(data.m_S / data.m_K);
+	pos.m_sqrtT = sqrt(data.m_T);
+	m_minSig = (Size() == 0) ? data.m_sig : min(m_minSig, data.m_sig);
+	m_european.push_back(pos);
+}
+
+void RiskEngine::Add(const AmericanOption& option, double quantity) {
+	const AmericanOptionData& data = option.GetData();
+	Position pos;
+	pos.m_S = data.m_S; pos.m_K = data.m_K; pos.m_T = 0.0;
+	pos.m_r = data.m_r; pos.m_sig = data.m_sig; pos.m_b = data.m_b;
+	pos.m_id = (option.GetType() == Type::call) ? 1.0 : (-1.0);
+	pos.m_qty = quantity;
+	pos.m_value = option.Price();
+	pos.m_logSK = 0.0;
+	pos.m_sqrtT = 0.0;
+	m_minSig = (Size() == 0) ? data.m_sig : min(m_minSig, data.m_sig);
+	m_american.push_back(pos);
+}
+
+void RiskEngine::Clear() {
+	m_european.clear();
+	m_american.clear();
+	m_minSig = 0.0;
+}
+
+double RiskEngine::Value() const {
+	double value = 0.0;
+	for (int i = 0; i < (int)m_european.size(); i++) {
+		value += m_european[i].m_qty * m_european[i].m_value;
+	}
+	for (int i = 0; i < (int)m_american.size(); i++) {
+		value += m_american[i].m_qty * m_american[i].m_value;
+	}
+	return value;
+}
+
+void RiskEngine::revalue(const vector<Scenario>& scenarios, size_t begin, size_t end, double* pnl) const {
+	double growth[BLOCK], logGrowth[BLOCK];
+	for (size_t first = begin; first < end; first += BLOCK) {
+		size_t n = min(BLOCK, end - first);
+		const Scenario* sc = &scenarios[first];
+		double* out = pnl + first;
+		// scenario intermediates shared by every position
+		for (size_t j = 0; j < n; j++) {
+			growth[j] = 1.0 + sc[j].m_dS;
+			logGrowth[j] = log(growth[j]);
+			out[j] = 0.0;
+		}
+		for (size_t i = 0; i < m_european.size(); i++) {
+			const Position& p = m_european[i];
+			for (size_t j = 0; j < n; j++) {
+				double sig = p.m_sig + sc[j].m_dsig;
+				double r = p.m_r + sc[j].m_dr;
+				double b = p.m_b + sc[j].m_db;
+				double sigSqrtT = sig * p.m_sqrtT;
+				double d1 = (p.m_logSK + logGrowth[j] + (b + 0.5 * sig * sig) * p.m_T) / sigSqrtT;
+				double d2 = d1 - sigSqrtT;
+				double V = p.m_id * (p.m_S * growth[j] * exp((b - r) * p.m_T) * NormalCdf(p.m_id * d1) - p.m_K * exp(-r * p.m_T) * NormalCdf(p.m_id * d2));
+				out[j] += p.m_qty * (V - p.m_value);
+			}
+		}
+		for (size_t i = 0; i < m_american.size(); i++) {
+			const Position& p = m_american[i];
+			for (size_t j = 0; j < n; j++) {
+				double V = PerpetualPrice(p.m_S * growth[j], p.m_K, p.m_r + sc[j].m_dr, p.m_sig + sc[j].m_dsig, p.m_b + sc[j].m_db, p.m_id);
+				out[j] += p.m_qty * (V - p.m_value);
+			}
+		}
+	}
+}
+
+// the perpetual formula needs a real root y of sig^2/2 y^2 + (b - sig^2/2) y - r = 0 on the
+// right side: y > 1 for a call, y < 0 for a put; otherwise its price is NaN or infinite
+static bool perpetual_valid(double r, double sig, double b, double id) {
+	double sig2 = sig * sig;
+	double disc = pow((b / sig2 - 0.5), 2) + 2 * r / sig2;
+	if (!(disc >= 0.0)) return false;
+	double y = 0.5 - b / sig2 + id * sqrt(disc);
+	return (id > 0.0) ? (y > 1.0) : (y < 0.0);
+}
+
+vector<double> RiskEngine::PnL(const vector<Scenario>& scenarios) const {
+	// validate up front: an exception thrown inside a worker thread could not be caught by the caller
+	for (int i = 0; i < (int)scenarios.size(); i++) {
+		const Scenario& sc = scenarios[i];
+		if ((Size() > 0) && (m_minSig + sc.m_dsig <= 0.0)) {
+			throw ImproperOptionDataException();
+		}
+		// rate and carry shifts can leave the perpetual formula without a valid root
+		for (int j = 0; j < (int)m_american.size(); j++) {
+			const Position& p = m_american[j];
+			if (!perpetual_valid(p.m_r + sc.m_dr, p.m_sig + sc.m_dsig, p.m_b + sc.m_db, p.m_id)) {
+				throw ImproperOptionDataException();
+			}
+		}
+	}
+
+	vector<double> pnl(scenarios.size(), 0.0);
+	if (scenarios.empty() || Size() == 0) return pnl;
+
+	size_t threads = (m_threads > 0) ? m_threads : max(1u, thread::hardware_concurrency());
+	size_t blocks = (scenarios.size() + BLOCK - 1) / BLOCK;
+	threads = min(threads, blocks);
+	// hand each thread a contiguous run of whole blocks so P&L writes never overlap
+	size_t per = (blocks + threads - 1) / threads * BLOCK;
+	vector<thread> workers;
+	for (size_t t = 1; t < threads; t++) {
+		size_t begin = t * per;
+		size_t end = min(scenarios.size(), begin + per);
+		if (begin < end) {
+			workers.push_back(thread(&RiskEngine::revalue, this, cref(scenarios), begin, end, pnl.data()));
+		}
+	}
+	revalue(scenarios, 0, min(scenarios.size(), per), pnl.data());
+	for (int t = 0; t < (int)workers.size(); t++) {
+		workers[t].join();
+	}
+	return pnl;
+}
+
+double RiskEngine::VaR(const vector<double>& pnl, double alpha) {
+	return ::VaR(pnl, alpha);
+}
+
+double RiskEngine::ES(const vector<double>& pnl, double alpha) {
+	return ::ES(pnl, alpha);
+}
+
+vector<Scenario> RiskEngine::MonteCarlo(int n, double spotVol, double sigVol, double rVol, double bVol, unsigned seed) {
+	mt19937 gen(seed);
+	normal_distribution<double> z(0.0, 1.0);
+	vector<Scenario> scenarios;
+	scenarios.reserve(n);
+	for (int i = 0; i < n; i++) {
+		double dS = exp(spotVol * z(gen)) - 1.0; // lognormal spot move keeps S positive
+		double dsig = sigVol * z(gen);
+		double dr = rVol * z(gen);
+		double db = bVol * z(gen);
+		scenarios.push_back(Scenario(dS, dsig, dr, db));
+	}
+	return scenarios;
+}
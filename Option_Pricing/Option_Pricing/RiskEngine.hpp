@@ -0,0 +1,63 @@
+#ifndef RiskEngine_HPP
+#define RiskEngine_HPP
+
+#include <vector>
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+#include "ImproperOptionDataException.hpp"
+
+using namespace std;
+
+struct Scenario {
+	double m_dS;	// relative spot shock: S -> S * (1 + dS)
+	double m_dsig;	// absolute volatility shift
+	double m_dr;	// absolute interest rate shift
+	double m_db;	// absolute cost of carry shift
+	Scenario(double dS, double dsig, double dr, double db) {
+		if (dS <= -1.0) { // shocked spot must stay positive
+			throw ImproperOptionDataException();
+		}
+		m_dS = dS;
+		m_dsig = dsig;
+		m_dr = dr;
+		m_db = db;
+	}
+};
+
+class RiskEngine {
+private:
+	// position record with the scenario-independent intermediates cached
+	struct Position {
+		double m_S, m_K, m_T, m_r, m_sig, m_b;
+		double m_id;		// +1 call, -1 put
+		double m_qty;		// signed quantity
+		double m_value;		// base (unshocked) value per contract
+		double m_logSK;		// log(S / K), European only
+		double m_sqrtT;		// sqrt(T), European only
+	};
+	vector<Position> m_european;
+	vector<Position> m_american;
+	double m_minSig;	// smallest volatility in the book, to validate vol shifts
+	int m_threads;		// 0: use hardware concurrency
+
+	void revalue(const vector<Scenario>& scenarios, size_t begin, size_t end, double* pnl) const;
+public:
+	RiskEngine() : m_minSig(0.0), m_threads(0) {};
+	RiskEngine(int threads) : m_minSig(0.0), m_threads(threads) {};
+	virtual ~RiskEngine() {};
+
+	void Add(const EuropeanOption& option, double quantity);
+	void Add(const AmericanOption& option, double quantity);
+	void Clear();
+	size_t Size() const { return m_european.size() + m_american.size(); };
+	void Threads(int threads) { m_threads = threads; };
+
+	double Value() const;
+	vector<double> PnL(const vector<Scenario>& scenarios) const;
+
+	static double VaR(const vector<double>& pnl, double alpha);	// as VaR() in RiskStats.hpp
+	static double ES(const vector<double>& pnl, double alpha);	// as ES() in RiskStats.hpp
+	static vector<Scenario> MonteCarlo(int n, double spotVol, double sigVol, double rVol, double bVol, unsigned seed);
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef RiskStats_HPP
+#define RiskStats_HPP
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Tail statistics of a P&L sample, shared by the scenario engine and the hedging backtest.
+// Losses are -P&L; the alpha quantile is the (alpha n)-th smallest loss.
+
+// value at risk: the alpha quantile of the losses
+inline double VaR(const vector<double>& pnl, double alpha) {
+	if (pnl.empty()) return 0.0;
+	vector<double> loss(pnl.size());
+	for (size_t i = 0; i < pnl.size(); i++) {
+		loss[i] = -pnl[i];
+	}
+	size_t k = min(pnl.size() - 1, (size_t)(alpha * pnl.size()));
+	nth_element(loss.begin(), loss.begin() + k, loss.end());
+	return loss[k];
+}
+
+// expected shortfall: the average of the losses at or beyond the VaR quantile
+inline double ES(const vector<double>& pnl, double alpha) {
+	if (pnl.empty()) return 0.0;
+	vector<double> loss(pnl.size());
+	for (size_t i = 0; i < pnl.size(); i++) {
+		loss[i] = -pnl[i];
+	}
+	size_t k = min(pnl.size() - 1, (size_t)(alpha * pnl.size()));
+	nth_element(loss.begin(), loss.begin() + k, loss.end());
+	double sum = 0.0;
+	for (size_t i = k; i < loss.size(); i++) {
+		sum += loss[i];
+	}
+	return sum / (loss.size() - k);
+}
+
+#endif
@@ -0,0 +1,165 @@
+#include "EuropeanOption.hpp"
+#include "BatchPricer.hpp"
+#include "FFTPricer.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+typedef chrono::steady_clock Clock;
+
+// largest difference to the closed form over strikes from 0.5 F to 2 F
+double MaxError(const FFTPricer& pricer, const EuropeanOptionData& data, const Type& type) {
+	double F = data.m_S * exp(data.m_b * data.m_T);
+	vector<double> strikes;
+	for (int i = 0; i <= 150; i++) {
+		strikes.push_back(F * (0.5 + 0.01 * i));
+	}
+	vector<double> fft = pricer.Price(BlackScholesCF(data), strikes, type);
+	vector<double> exact = EuropeanOption(data, type).Price(strikes, 1);
+	double worst = 0.0;
+	for (size_t i = 0; i < strikes.size(); i++) {
+		worst = max(worst, abs(fft[i] - exact[i]));
+	}
+	return worst;
+}
+
+int main() {
+	try {
+		/* FFT (Carr-Madan) whole-chain pricing */
+
+		// a) against the closed form
+		cout << "=== FFT.(a) ===" << endl;
+		FFTPricer pricer;
+		EuropeanOptionData batch1(60, 65, 0.25, 0.08, 0.30, 0.08);
+		vector<double> strikes;
+		strikes.push_back(50);
+		strikes.push_back(65);
+		strikes.push_back(80);
+		vector<double> calls = pricer.Price(BlackScholesCF(batch1), strikes, Type::call);
+		vector<double> puts = pricer.Price(BlackScholesCF(batch1), strikes, Type::put);
+		cout << setprecision(10) << "Batch 1, K = 65: FFT call " << calls[1] << ", put " << puts[1] << "; closed form call "
+			<< EuropeanOption(batch1, Type::call).Price() << ", put " << EuropeanOption(batch1, Type::put).Price() << endl;
+		cout << setprecision(3) << "Largest error over K in [0.5F, 2F]:" << endl;
+		cout << "T\tsig\tCall\t\tPut" << endl;
+		double expiries[] = { 0.05, 0.25, 1.0, 5.0 };
+		double vols[] = { 0.1, 0.3, 0.6 };
+		for (int e = 0; e < 4; e++) {
+			for (int v = 0; v < 3; v++) {
+				EuropeanOptionData data(100, 100, expiries[e], 0.05, vols[v], 0.02);
+				cout << expiries[e] << "\t" << vols[v] << "\t" << MaxError(pricer, data, Type::call) << "\t" << MaxError(pricer, data, Type::put) << endl;
+			}
+		}
+		cout << endl;
+
+		// b) grid size and damping
+		cout << "=== FFT.(b) ===" << endl;
+		EuropeanOptionData data(100, 100, 0.5, 0.05, 0.25, 0.02);
+		cout << "N\teta\talpha\tError" << endl;
+		size_t sizes[] = { 1024, 4096, 4096, 16384 };
+		double etas[] = { 0.25, 0.25, 0.1, 0.25 };
+		double alphas[] = { 0.75, 1.5, 3.0 };
+		for (int s = 0; s < 4; s++) {
+			for (int a = 0; a < 3; a++) {
+				FFTPricer custom(sizes[s], etas[s], alphas[a]);
+				cout << sizes[s] << "\t" << etas[s] << "\t" << alphas[a] << "\t" << MaxError(custom, data, Type::call) << endl;
+			}
+		}
+		cout << endl;
+
+		// c) crossover: whole chain by FFT vs per-strike closed form
+		cout << "=== FFT.(c) ===" << endl;
+		cout << setprecision(4) << "Strikes\tPrice(vector, 1) us\tBatchPrice us\tFFT us" << endl;
+		EuropeanOption option(data, Type::call);
+		BlackScholesCF cf(data);
+		for (size_t n = 16; n <= 65536; n *= 4) {
+			vector<double> chain(n);
+			vector<EuropeanOptionData> batch;
+			for (size_t i = 0; i < n; i++) {
+				chain[i] = 60.0 + 100.0 * i / n;
+				batch.push_back(EuropeanOptionData(100, chain[i], 0.5, 0.05, 0.25, 0.02));
+			}
+			vector<double> out(n);
+			int repeats = (int)max((size_t)3, 200000 / n);
+			double sink = 0.0;
+
+			Clock::time_point start = Clock::now();
+			for (int k = 0; k < repeats; k++) {
+				sink += option.Price(chain, 1)[0];
+			}
+			double loopUs = chrono::duration<double, micro>(Clock::now() - start).count() / repeats;
+
+			start = Clock::now();
+			for (int k = 0; k < repeats; k++) {
+				BatchPrice(batch.data(), Type::call, n, out.data());
+				sink += out[0];
+			}
+			double batchUs = chrono::duration<double, micro>(Clock::now() - start).count() / repeats;
+
+			start = Clock::now();
+			for (int k = 0; k < repeats; k++) {
+				sink += pricer.Price(cf, chain, Type::call)[0];
+			}
+			double fftUs = chrono::duration<double, micro>(Clock::now() - start).count() / repeats;
+			cout << n << "\t" << loopUs << "\t\t\t" << batchUs << "\t\t" << fftUs << endl;
+		}
+		vector<double> grid;
+		Clock::time_point start = Clock::now();
+		for (int k = 0; k < 200; k++) {
+			pricer.Calls(cf, grid);
+		}
+		cout << "Native grid of " << grid.size() << " strikes (" << grid[0] << " to " << grid.back() << "): "
+			<< chrono::duration<double, micro>(Clock::now() - start).count() / 200 << " us" << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== FFT.(a) ===
+Batch 1, K = 65: FFT call 2.13336845, put 5.846282215; closed form call 2.133368445, put 5.84628221
+Largest error over K in [0.5F, 2F]:
+T	sig	Call		Put
+0.05	0.1	8.43e-05	8.43e-05
+0.05	0.3	3.82e-06	3.82e-06
+0.05	0.6	4.75e-07	4.75e-07
+0.25	0.1	9.26e-06	9.26e-06
+0.25	0.3	4.11e-07	4.11e-07
+0.25	0.6	2.41e-07	2.41e-07
+1	0.1	9.81e-07	9.81e-07
+1	0.3	2.36e-07	2.36e-07
+1	0.6	2.14e-07	2.14e-07
+5	0.1	2.4e-07	2.4e-07
+5	0.3	1.89e-07	1.89e-07
+5	0.6	2.74e-07	2.74e-07
+
+=== FFT.(b) ===
+N	eta	alpha	Error
+1024	0.25	0.75	0.00268
+1024	0.25	1.5	5.59e-05
+1024	0.25	3	5.61e-05
+4096	0.25	0.75	0.00265
+4096	0.25	1.5	3.3e-07
+4096	0.25	3	2.2e-07
+4096	0.1	0.75	8.83e-06
+4096	0.1	1.5	8.83e-06
+4096	0.1	3	8.83e-06
+16384	0.25	0.75	0.00265
+16384	0.25	1.5	2.14e-07
+16384	0.25	3	8.93e-10
+
+=== FFT.(c) ===
+Strikes	Price(vector, 1) us	BatchPrice us	FFT us
+16	5.074			1.137		119
+64	22.1			4.946		136.4
+256	91.83			17.79		148.8
+1024	353.4			75.37		167.2
+4096	1422			302.8		243.4
+16384	5682			1195		525.8
+65536	2.269e+04			4773		1880
+Native grid of 4096 strikes (0.0003522 to 2.879e+07): 140.2 us
+*/
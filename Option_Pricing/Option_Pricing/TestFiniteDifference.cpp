@@ -0,0 +1,130 @@
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+#include "FiniteDifference.hpp"
+#include <iostream>
+#include <iomanip>
+
+// sweep function that counts the option prices it computes, the way AdaptiveDerivative counts its own
+class CountedBump {
+private:
+	Bump<EuropeanOption> m_bump;
+	int& m_count;
+public:
+	CountedBump(const EuropeanOption& option, int para, int& count) : m_bump(option, para), m_count(count) {};
+	vector<double> operator () (const vector<double>& points) const { m_count += (int)points.size(); return m_bump(points); };
+};
+
+// fixed-h central differences, as ApproxDelta(h) and ApproxGamma(h)
+double FixedDelta(const CountedBump& f, double x, double h) {
+	vector<double> points;
+	points.push_back(x + h);
+	points.push_back(x - h);
+	vector<double> V = f(points);
+	return (V[0] - V[1]) / (2.0 * h);
+}
+
+double FixedGamma(const CountedBump& f, double x, double h) {
+	vector<double> points;
+	points.push_back(x - h);
+	points.push_back(x);
+	points.push_back(x + h);
+	vector<double> V = f(points);
+	return (V[0] - 2 * V[1] + V[2]) / pow(h, 2);
+}
+
+int main() {
+	try {
+		/* Adaptive, Richardson-extrapolated finite-difference Greeks */
+
+		// a) A.II.(d) data: adaptive vs the fixed-h table
+		cout << "=== FD.(a) ===" << endl;
+		EuropeanOption option(105, 100, 0.5, 0.1, 0.36, 0);
+		double delta = option.Delta(), gamma = option.Gamma();
+		cout << "Method\t\tDelta Err\tEvals\tGamma Err\tEvals" << endl;
+		double S = option.GetData().m_S;
+		int searchDelta = 0, searchGamma = 0;
+		for (int i = 1; i < 11; i++) {
+			double h = pow(10, -i);
+			int deltaEvals = 0, gammaEvals = 0;
+			double deltaErr = abs(FixedDelta(CountedBump(option, 0, deltaEvals), S, h) - delta);
+			double gammaErr = abs(FixedGamma(CountedBump(option, 0, gammaEvals), S, h) - gamma);
+			searchDelta += deltaEvals;
+			searchGamma += gammaEvals;
+			if (i % 3 == 1) {
+				cout << setprecision(3) << "Fixed h=1e" << -i << "\t" << deltaErr << "\t\t" << deltaEvals << "\t"
+					<< gammaErr << "\t\t" << gammaEvals << endl;
+			}
+		}
+		double tols[] = { 1e-6, 1e-9, 1e-12 };
+		for (int i = 0; i < 3; i++) {
+			FDResult d = AdaptiveDelta(option, tols[i]);
+			FDResult g = AdaptiveGamma(option, tols[i]);
+			cout << "Adaptive " << tols[i] << "\t" << abs(d.m_value - delta) << "\t" << d.m_evaluations << "\t"
+				<< abs(g.m_value - gamma) << "\t" << g.m_evaluations << endl;
+		}
+		cout << "Fixed-h search over 10 values of h: " << searchDelta << " evaluations for delta, " << searchGamma << " for gamma" << endl;
+		cout << endl;
+
+		// b) a class without analytic Greeks: perpetual American option
+		cout << "=== FD.(b) ===" << endl;
+		AmericanOption american(110, 100, 0.1, 0.1, 0.02);
+		// closed form for reference: V = A S^y, so dV/dS = y V / S and d2V/dS2 = y (y - 1) V / S^2
+		double sig2 = 0.1 * 0.1;
+		double y = 0.5 - 0.02 / sig2 + sqrt(pow((0.02 / sig2 - 0.5), 2) + 2 * 0.1 / sig2);
+		double V = american.Price();
+		FDResult d = AdaptiveDelta(american, 1e-10);
+		FDResult g = AdaptiveGamma(american, 1e-10);
+		cout << setprecision(10) << "Delta = " << d.m_value << " (exact " << y * V / 110 << ", " << d.m_evaluations << " evaluations)" << endl;
+		cout << "Gamma = " << g.m_value << " (exact " << y * (y - 1) * V / (110 * 110) << ", " << g.m_evaluations << " evaluations)" << endl;
+		cout << endl;
+
+		// c) any parameter: vega by bumping sig (para 4)
+		cout << "=== FD.(c) ===" << endl;
+		FDResult vega = AdaptiveDerivative(Bump<EuropeanOption>(option, 4), option.GetData().m_sig, 1, 1e-10);
+		cout << "Vega = " << vega.m_value << " (exact " << option.Vega() << ", " << vega.m_evaluations << " evaluations)" << endl;
+		cout << endl;
+
+		// d) small positive parameters: the bumps must not cross zero. At sig = 0.5% the gamma-sized
+		// starting step of sig would; volga = vega d1 d2 / sig for reference
+		cout << "=== FD.(d) ===" << endl;
+		EuropeanOption quiet(100, 100.2, 0.5, 0.1, 0.005, 0);
+		double qs = quiet.GetData().m_sig;
+		double d1 = (log(100.0 / 100.2) + 0.5 * qs * qs * 0.5) / (qs * sqrt(0.5));
+		double d2 = d1 - qs * sqrt(0.5);
+		FDResult qVega = AdaptiveDerivative(Bump<EuropeanOption>(quiet, 4), qs, 1, 1e-10);
+		FDResult qVolga = AdaptiveDerivative(Bump<EuropeanOption>(quiet, 4), qs, 2, 1e-8);
+		cout << "Vega = " << qVega.m_value << " (exact " << quiet.Vega() << ", " << qVega.m_evaluations << " evaluations)" << endl;
+		cout << "Volga = " << qVolga.m_value << " (exact " << quiet.Vega() * d1 * d2 / qs << ", " << qVolga.m_evaluations << " evaluations)" << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== FD.(a) ===
+Method		Delta Err	Evals	Gamma Err	Evals
+Fixed h=1e-1	4.83e-07		2	8.26e-09		3
+Fixed h=1e-4	3.91e-11		2	4.31e-07		3
+Fixed h=1e-7	2.9e-08		2	1.41		3
+Fixed h=1e-10	6.01e-05		2	7.11e+05		3
+Adaptive 1e-06	2.1e-13	4	1.36e-11	5
+Adaptive 1e-09	8.57e-14	6	5.79e-14	7
+Adaptive 1e-12	8.57e-14	6	6.54e-12	13
+Fixed-h search over 10 values of h: 20 evaluations for delta, 30 for gamma
+
+=== FD.(b) ===
+Delta = 0.5411416778 (exact 0.5411416778, 6 evaluations)
+Gamma = 0.01090641813 (exact 0.01090641813, 7 evaluations)
+
+=== FD.(c) ===
+Vega = 26.77812285 (exact 26.77812285, 6 evaluations)
+
+=== FD.(d) ===
+Vega = 22.89629062 (exact 22.89629062, 10 evaluations)
+Volga = 1462.422928 (exact 1462.422927, 13 evaluations)
+*/
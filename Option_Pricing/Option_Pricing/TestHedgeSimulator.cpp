@@ -0,0 +1,141 @@
+#include "EuropeanOption.hpp"
+#include "HedgeSimulator.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <thread>
+
+typedef chrono::steady_clock Clock;
+
+// the way the backtests used to run: a new EuropeanOption and a full Delta() at every step
+double NaiveBacktest(const EuropeanOptionData& d, int steps, size_t paths, unsigned seed) {
+	mt19937_64 gen(seed);
+	normal_distribution<double> normal(0.0, 1.0);
+	double dt = d.m_T / steps, sum = 0.0;
+	for (size_t p = 0; p < paths; p++) {
+		double S = d.m_S;
+		double shares = EuropeanOption(d).Delta();
+		double cash = EuropeanOption(d).Price() - shares * S;
+		for (int j = 1; j <= steps; j++) {
+			S *= exp((d.m_r - 0.5 * d.m_sig * d.m_sig) * dt + d.m_sig * sqrt(dt) * normal(gen));
+			cash *= exp(d.m_r * dt);
+			if (j < steps) {
+				double delta = EuropeanOption(S, d.m_K, d.m_T - j * dt, d.m_r, d.m_sig, d.m_b).Delta();
+				cash -= (delta - shares) * S;
+				shares = delta;
+			}
+		}
+		sum += cash + shares * S - max(S - d.m_K, 0.0);
+	}
+	return sum / paths;
+}
+
+int main() {
+	try {
+		/* Delta-hedging backtest */
+
+		EuropeanOption call(100, 100, 0.5, 0.05, 0.2, 0.05);
+		const size_t paths = 20000;
+
+		// a) hedging error against rebalancing frequency, no costs, realized vol = implied
+		cout << "=== Hedge.(a) ===" << endl;
+		cout << "Premium " << call.Price() << endl;
+		cout << "Rebalance\tMean P&L\tStdev\t95% VaR\t95% ES" << endl;
+		int frequencies[] = { 1, 4, 16, 64 };
+		for (int i = 0; i < 4; i++) {
+			HedgeSimulator simulator(call, 0.10, 0.2);
+			simulator.Steps(256, frequencies[i]);
+			HedgeResult result = simulator.Run(paths, 42);
+			cout << setprecision(4) << "every " << frequencies[i] << "\t\t" << result.m_mean << "\t" << result.m_stdev << "\t" << result.m_VaR << "\t" << result.m_ES << endl;
+		}
+		cout << "(Stdev should roughly double for every fourfold reduction in rebalances)" << endl;
+		cout << endl;
+
+		// b) transaction costs and a realized vol away from the implied one
+		cout << "=== Hedge.(b) ===" << endl;
+		cout << "Cost\tRealized\tRebalance\tMean P&L\tStdev\tMean cost" << endl;
+		double costs[] = { 0.0, 0.001, 0.005 };
+		double realized[] = { 0.15, 0.2, 0.25 };
+		for (int c = 0; c < 3; c++) {
+			for (int v = 0; v < 3; v++) {
+				for (int f = 0; f < 2; f++) {
+					HedgeSimulator simulator(call, 0.10, realized[v]);
+					simulator.Steps(256, (f == 0) ? 1 : 16);
+					simulator.Cost(costs[c]);
+					HedgeResult result = simulator.Run(paths, 42);
+					cout << costs[c] << "\t" << realized[v] << "\t\tevery " << ((f == 0) ? 1 : 16) << "\t" << result.m_mean << "\t"
+						<< result.m_stdev << "\t" << result.m_meanCost << endl;
+				}
+			}
+		}
+		cout << endl;
+
+		// c) throughput: per-object backtest vs simulator, thread scaling
+		cout << "=== Hedge.(c) ===" << endl;
+		const int steps = 256;
+		Clock::time_point start = Clock::now();
+		size_t naivePaths = 500;
+		double naiveMean = NaiveBacktest(call.GetData(), steps, naivePaths, 1);
+		double naiveRate = naivePaths * steps / chrono::duration<double>(Clock::now() - start).count();
+		cout << setprecision(4) << "EuropeanOption per step: " << naiveRate << " path-steps/s (mean P&L " << naiveMean << ")" << endl;
+		cout << "Threads\tPath-steps/s\tSpeed-up\tMean P&L" << endl;
+		unsigned maxThreads = max(1u, thread::hardware_concurrency());
+		for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+			HedgeSimulator simulator(call, 0.05, 0.2);
+			simulator.Steps(steps, 1);
+			simulator.Threads(threads);
+			HedgeResult result = simulator.Run(100000, 1);
+			cout << threads << "\t" << result.m_pathStepsPerSecond << "\t" << result.m_pathStepsPerSecond / naiveRate << "\t\t" << result.m_mean << endl;
+		}
+		HedgeSimulator one(call, 0.05, 0.2), many(call, 0.05, 0.2);
+		one.Threads(1);
+		many.Threads(4);
+		cout << "Same P&L with 1 and 4 threads: " << ((one.Run(3000, 9).m_pnl == many.Run(3000, 9).m_pnl) ? "yes" : "no") << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Hedge.(a) ===
+Premium 6.88873
+Rebalance	Mean P&L	Stdev	95% VaR	95% ES
+every 1		-0.003158	0.3062	0.5043	0.7074
+every 4		-0.01157	0.6072	1.009	1.421
+every 16		-0.01594	1.183	1.972	2.807
+every 64		-0.03882	2.263	3.946	5.517
+(Stdev should roughly double for every fourfold reduction in rebalances)
+
+=== Hedge.(b) ===
+Cost	Realized	Rebalance	Mean P&L	Stdev	Mean cost
+0	0.15		every 1	1.357	0.5173	0
+0	0.15		every 16	1.345	0.9934	0
+0	0.2		every 1	-0.003158	0.3062	0
+0	0.2		every 16	-0.01594	1.183	0
+0	0.25		every 1	-1.394	0.713	0
+0	0.25		every 16	-1.407	1.6	0
+0.001	0.15		every 1	0.8015	0.4165	0.5491
+0.001	0.15		every 16	1.109	1.001	0.2332
+0.001	0.2		every 1	-0.6316	0.3689	0.6208
+0.001	0.2		every 16	-0.2664	1.197	0.2475
+0.001	0.25		every 1	-2.079	0.915	0.6767
+0.001	0.25		every 16	-1.669	1.625	0.2592
+0.005	0.15		every 1	-1.421	0.4128	2.745
+0.005	0.15		every 16	0.1647	1.052	1.166
+0.005	0.2		every 1	-3.146	1.001	3.104
+0.005	0.2		every 16	-1.268	1.275	1.237
+0.005	0.25		every 1	-4.821	1.797	3.384
+0.005	0.25		every 16	-2.719	1.75	1.296
+
+=== Hedge.(c) ===
+EuropeanOption per step: 4.104e+06 path-steps/s (mean P&L -0.01741)
+Threads	Path-steps/s	Speed-up	Mean P&L
+1	1.287e+07	3.135		-0.0005963
+Same P&L with 1 and 4 threads: yes
+*/
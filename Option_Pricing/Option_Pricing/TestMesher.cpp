@@ -0,0 +1,189 @@
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+#include "Mesher.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+typedef chrono::steady_clock Clock;
+
+int main() {
+	try {
+		/* Lazy mesh ranges */
+
+		// a) points by index vs. repeated addition
+		cout << "=== Mesh.(a) ===" << endl;
+		UniformMesh T_range(0.20, 0.30, 0.01);
+		double added = 0.20;
+		cout << setprecision(17) << "i\tIndexed\t\t\tRepeated addition" << endl;
+		for (size_t i = 0; i < T_range.size(); i++) {
+			cout << i << "\t" << T_range[i] << "\t" << added << endl;
+			added += 0.01;
+		}
+		UniformMesh fine(0.0, 1.0, 1e-6);
+		added = 0.0;
+		for (size_t i = 1; i < fine.size(); i++) {
+			added += 1e-6;
+		}
+		cout << "Last point of [0, 1] with h = 1e-6: indexed = " << fine[fine.size() - 1] << ", repeated addition = " << added << endl;
+		// end points a whole number of steps away are included even when the division lands below
+		UniformMesh tenth(0.1, 0.7, 0.1);
+		cout << "[0.20, 0.30] by 0.01: " << T_range.size() << " points, last " << T_range[T_range.size() - 1] << endl;
+		cout << "[0.1, 0.7] by 0.1: " << tenth.size() << " points, last " << tenth[tenth.size() - 1] << endl;
+		cout << endl;
+
+		// b) the other ranges
+		cout << "=== Mesh.(b) ===" << endl << setprecision(5);
+		LogMesh log_S(10.0, 1000.0, 5);
+		ChebyshevMesh cheb_S(55.0, 65.0, 5);
+		StrikeMesh strike_S(20.0, 120.0, 65.0, 5.0, 5);
+		cout << "Log\tCheb\tStrike" << endl;
+		for (size_t i = 0; i < 5; i++) {
+			cout << log_S[i] << "\t" << cheb_S[i] << "\t" << strike_S[i] << endl;
+		}
+		cout << "Range-for over the log mesh:";
+		for (double S : log_S) {
+			cout << " " << S;
+		}
+		cout << endl << endl;
+
+		// c) sweeps accept the ranges directly and agree with the materialized mesh
+		cout << "=== Mesh.(c) ===" << endl;
+		EuropeanOption batch1(60, 65, 0.25, 0.08, 0.30, 0.08);
+		AmericanOption perpetual(110, 100, 0.1, 0.1, 0.02);
+		vector<double> lazy = batch1.Price(UniformMesh(55.0, 65.0, 1.0), 0);
+		vector<double> materialized = batch1.Price(Mesher(55.0, 65.0, 1.0), 0);
+		vector<double> delta = batch1.Delta(ChebyshevMesh(55.0, 65.0, 11), 0);
+		vector<double> american = perpetual.Price(UniformMesh(105.0, 115.0, 1.0), 0);
+		cout << "S\tLazy\tMesher\tS\tDelta\tS\tAmerican" << endl;
+		for (size_t i = 0; i < lazy.size(); i++) {
+			cout << 55.0 + i << "\t" << lazy[i] << "\t" << materialized[i] << "\t"
+				<< ChebyshevMesh(55.0, 65.0, 11)[i] << "\t" << delta[i] << "\t" << 105.0 + i << "\t" << american[i] << endl;
+		}
+		vector<UniformMesh> grid;
+		grid.push_back(UniformMesh(0.20, 0.30, 0.01));
+		grid.push_back(UniformMesh(0.10, 0.50, 0.04));
+		vector<int> paras;
+		paras.push_back(2);
+		paras.push_back(4);
+		vector<vector<double>> surface = batch1.Price(grid, paras);
+		cout << "T\tCall\tsig\tCall" << endl;
+		for (size_t i = 0; i < surface[0].size(); i++) {
+			cout << grid[0][i] << "\t" << surface[0][i] << "\t" << grid[1][i] << "\t" << surface[1][i] << endl;
+		}
+		// the Greek sweeps over ranges, single and grid, against the vector<double> overloads
+		vector<vector<double>> points;
+		points.push_back(Mesher(0.20, 0.30, 0.01));
+		points.push_back(Mesher(0.10, 0.50, 0.04));
+		UniformMesh S_range(55.0, 65.0, 1.0);
+		vector<vector<vector<double>>> lazyGreeks, vectorGreeks;
+		lazyGreeks.push_back(batch1.Delta(grid, paras));
+		vectorGreeks.push_back(batch1.Delta(points, paras));
+		lazyGreeks.push_back(batch1.Gamma(grid, paras));
+		vectorGreeks.push_back(batch1.Gamma(points, paras));
+		lazyGreeks.push_back(batch1.ApproxDelta(0.01, grid, paras));
+		vectorGreeks.push_back(batch1.ApproxDelta(0.01, points, paras));
+		lazyGreeks.push_back(batch1.ApproxGamma(0.01, grid, paras));
+		vectorGreeks.push_back(batch1.ApproxGamma(0.01, points, paras));
+		lazyGreeks.push_back(vector<vector<double>>(1, batch1.ApproxDelta(0.01, S_range, 0)));
+		vectorGreeks.push_back(vector<vector<double>>(1, batch1.ApproxDelta(0.01, Mesher(55.0, 65.0, 1.0), 0)));
+		lazyGreeks.push_back(vector<vector<double>>(1, batch1.ApproxGamma(0.01, S_range, 0)));
+		vectorGreeks.push_back(vector<vector<double>>(1, batch1.ApproxGamma(0.01, Mesher(55.0, 65.0, 1.0), 0)));
+		const char* names[] = { "Delta grid", "Gamma grid", "ApproxDelta grid", "ApproxGamma grid", "ApproxDelta", "ApproxGamma" };
+		cout << "Largest difference, range vs vector<double> sweep:";
+		for (size_t k = 0; k < lazyGreeks.size(); k++) {
+			double diff = 0.0;
+			for (size_t j = 0; j < lazyGreeks[k].size(); j++) {
+				for (size_t i = 0; i < lazyGreeks[k][j].size(); i++) {
+					diff = max(diff, abs(lazyGreeks[k][j][i] - vectorGreeks[k][j][i]));
+				}
+			}
+			cout << ((k == 0) ? " " : ", ") << names[k] << " " << diff;
+		}
+		cout << endl << endl;
+
+		// d) very large sweep: memory and time
+		cout << "=== Mesh.(d) ===" << endl;
+		const double h = 1e-5;
+		Clock::time_point start = Clock::now();
+		vector<double> mesh = Mesher(10.0, 110.0, h);
+		vector<double> byVector = batch1.Price(mesh, 0);
+		double vectorMs = chrono::duration<double, milli>(Clock::now() - start).count();
+		size_t meshBytes = mesh.size() * sizeof(double);
+		mesh = vector<double>();
+
+		start = Clock::now();
+		vector<double> byRange = batch1.Price(UniformMesh(10.0, 110.0, h), 0);
+		double rangeMs = chrono::duration<double, milli>(Clock::now() - start).count();
+		cout << "Points: " << byRange.size() << endl;
+		cout << "Mesher + Price(vector): " << setprecision(4) << vectorMs << " ms, input mesh " << meshBytes / 1048576.0 << " MB" << endl;
+		cout << "Price(UniformMesh):     " << rangeMs << " ms, input mesh " << sizeof(UniformMesh) << " bytes" << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Mesh.(a) ===
+i	Indexed			Repeated addition
+0	0.20000000000000001	0.20000000000000001
+1	0.21000000000000002	0.21000000000000002
+2	0.22	0.22000000000000003
+3	0.23000000000000001	0.23000000000000004
+4	0.24000000000000002	0.24000000000000005
+5	0.25	0.25000000000000006
+6	0.26000000000000001	0.26000000000000006
+7	0.27000000000000002	0.27000000000000007
+8	0.28000000000000003	0.28000000000000008
+9	0.29000000000000004	0.29000000000000009
+10	0.30000000000000004	0.3000000000000001
+Last point of [0, 1] with h = 1e-6: indexed = 1, repeated addition = 1.0000000000079181
+[0.20, 0.30] by 0.01: 11 points, last 0.30000000000000004
+[0.1, 0.7] by 0.1: 7 points, last 0.70000000000000007
+
+=== Mesh.(b) ===
+Log	Cheb	Strike
+10	55.245	20
+31.623	57.061	55.513
+100	60	65.5
+316.23	62.939	76.832
+1000	64.755	120
+Range-for over the log mesh: 10 31.623 100 316.23 1000
+
+=== Mesh.(c) ===
+S	Lazy	Mesher	S	Delta	S	American
+55	0.76652	0.76652	55.051	0.18427	105	15.932
+56	0.96568	0.96568	55.452	0.19744	106	16.425
+57	1.1997	1.1997	56.221	0.22394	107	16.929
+58	1.4711	1.4711	57.297	0.26349	108	17.443
+59	1.7817	1.7817	58.591	0.31431	109	17.968
+60	2.1334	2.1334	60	0.37248	110	18.503
+61	2.527	2.527	61.409	0.43228	111	19.05
+62	2.9632	2.9632	62.703	0.48744	112	19.608
+63	3.442	3.442	63.779	0.53263	113	20.177
+64	3.9629	3.9629	64.548	0.56428	114	20.757
+65	4.5252	4.5252	64.949	0.58048	115	21.348
+T	Call	sig	Call
+0.2	1.701	0.1	0.1731
+0.21	1.7893	0.14	0.46919
+0.22	1.8767	0.18	0.83978
+0.23	1.9631	0.22	1.2506
+0.24	2.0487	0.26	1.6847
+0.25	2.1334	0.3	2.1334
+0.26	2.2172	0.34	2.5916
+0.27	2.3003	0.38	3.0562
+0.28	2.3826	0.42	3.5254
+0.29	2.4641	0.46	3.9978
+0.3	2.5449	0.5	4.4724
+Largest difference, range vs vector<double> sweep: Delta grid 0, Gamma grid 0, ApproxDelta grid 0, ApproxGamma grid 0, ApproxDelta 0, ApproxGamma 0
+
+=== Mesh.(d) ===
+Points: 10000001
+Mesher + Price(vector): 3782 ms, input mesh 76.29 MB
+Price(UniformMesh):     4229 ms, input mesh 24 bytes
+*/
@@ -0,0 +1,178 @@
+#include "EuropeanOption.hpp"
+#include "BatchPricer.hpp"
+#include "OptionChain.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+typedef chrono::steady_clock Clock;
+
+// largest difference between the chain and standalone EuropeanOption objects over all strikes
+double MaxError(const OptionChain& chain, double S, double r, double b, const vector<double>& vols) {
+	double worst = 0.0;
+	for (size_t e = 0; e < chain.Expiries(); e++) {
+		size_t n = chain.Strikes(e);
+		vector<double> call(n), put(n), callDelta(n), putDelta(n), gamma(n), vega(n);
+		chain.Price(e, call.data(), put.data());
+		chain.Risk(e, callDelta.data(), putDelta.data(), gamma.data(), vega.data());
+		for (size_t i = 0; i < n; i++) {
+			EuropeanOption c(S, chain.GetStrikes(e)[i], chain.GetT(e), r, vols[e], b, Type::call);
+			EuropeanOption p(S, chain.GetStrikes(e)[i], chain.GetT(e), r, vols[e], b, Type::put);
+			double diffs[] = { call[i] - c.Price(), put[i] - p.Price(), callDelta[i] - c.Delta(), putDelta[i] - p.Delta(), gamma[i] - c.Gamma(), vega[i] - c.Vega() };
+			for (int j = 0; j < 6; j++) {
+				worst = max(worst, abs(diffs[j]));
+			}
+		}
+	}
+	return worst;
+}
+
+int main() {
+	try {
+		/* Expiry-bucketed option chain */
+
+		double S = 100, r = 0.05, b = 0.02;
+		double expiryArray[] = { 0.02, 0.08, 0.25, 0.5, 0.75, 1.0, 1.5, 2.0 };
+		vector<double> vols;
+		OptionChain chain(S, r, b);
+		for (int e = 0; e < 8; e++) {
+			vector<double> strikes;
+			for (int i = 0; i < 50; i++) {
+				strikes.push_back(60.0 + 1.6 * i);
+			}
+			vols.push_back(0.18 + 0.02 * e);
+			chain.AddExpiry(expiryArray[e], vols[e], strikes);
+		}
+
+		// a) agreement with standalone EuropeanOption objects
+		cout << "=== Chain.(a) ===" << endl;
+		cout << "Largest difference (price, delta, gamma, vega; calls and puts): " << setprecision(3) << MaxError(chain, S, r, b, vols) << endl;
+		vector<double> call(50), put(50);
+		chain.Price(3, call.data(), put.data());
+		cout << setprecision(6) << "T = 0.5, K = 100: call " << call[25] << ", put " << put[25] << endl;
+		// far out-of-the-money puts are worth less than the rounding error of parity C - F + K e^(-rT)
+		chain.Price(1, call.data(), put.data());
+		double wing = EuropeanOption(S, chain.GetStrikes(1)[6], 0.08, r, vols[1], b, Type::put).Price();
+		cout << "T = 0.08, K = 69.6: put " << put[6] << ", EuropeanOption " << wing << ", relative difference " << setprecision(3) << abs(put[6] - wing) / wing << endl;
+		cout << endl;
+
+		// b) spot and single-expiry vol updates
+		cout << "=== Chain.(b) ===" << endl;
+		chain.SetSpot(101.5);
+		vols[3] = 0.30;
+		chain.SetVol(3, vols[3]);
+		cout << "After SetSpot(101.5) and SetVol(3, 0.30), largest difference: " << setprecision(3) << MaxError(chain, 101.5, r, b, vols) << endl;
+		chain.Price(3, call.data(), put.data());
+		cout << setprecision(6) << "T = 0.5, K = 100: call " << call[25] << ", put " << put[25] << endl;
+		chain.SetSpot(S);
+		vols[3] = 0.24;
+		chain.SetVol(3, vols[3]);
+		cout << endl;
+
+		// c) the whole chain, both types: standalone objects vs batch kernel vs chain
+		cout << "=== Chain.(c) ===" << endl;
+		const int repeats = 2000;
+		size_t contracts = 8 * 50 * 2;
+		vector<EuropeanOptionData> data;
+		vector<Type> types;
+		vector<EuropeanOption> options;
+		for (size_t e = 0; e < chain.Expiries(); e++) {
+			for (size_t i = 0; i < chain.Strikes(e); i++) {
+				for (int t = 0; t < 2; t++) {
+					Type type = (t == 0) ? Type::call : Type::put;
+					data.push_back(EuropeanOptionData(S, chain.GetStrikes(e)[i], chain.GetT(e), r, vols[e], b));
+					types.push_back(type);
+					options.push_back(EuropeanOption(data.back(), type));
+				}
+			}
+		}
+		vector<double> out(contracts);
+		double sink = 0.0;
+
+		Clock::time_point start = Clock::now();
+		for (int k = 0; k < repeats / 20; k++) {
+			for (size_t i = 0; i < contracts; i++) {
+				out[i] = options[i].Price();
+			}
+			sink += out[0];
+		}
+		double objectNs = chrono::duration<double, nano>(Clock::now() - start).count() / (repeats / 20) / contracts;
+
+		start = Clock::now();
+		for (int k = 0; k < repeats; k++) {
+			BatchPrice(data.data(), types.data(), contracts, out.data());
+			sink += out[0];
+		}
+		double batchNs = chrono::duration<double, nano>(Clock::now() - start).count() / repeats / contracts;
+
+		start = Clock::now();
+		for (int k = 0; k < repeats; k++) {
+			for (size_t e = 0; e < chain.Expiries(); e++) {
+				chain.Price(e, call.data(), put.data());
+			}
+			sink += call[0];
+		}
+		double chainNs = chrono::duration<double, nano>(Clock::now() - start).count() / repeats / contracts;
+
+		vector<double> callDelta(50), putDelta(50), gamma(50), vega(50);
+		start = Clock::now();
+		for (int k = 0; k < repeats / 20; k++) {
+			for (size_t i = 0; i < contracts; i++) {
+				out[i] = options[i].Delta() + options[i].Gamma() + options[i].Vega();
+			}
+			sink += out[0];
+		}
+		double objectRiskNs = chrono::duration<double, nano>(Clock::now() - start).count() / (repeats / 20) / contracts;
+
+		start = Clock::now();
+		for (int k = 0; k < repeats; k++) {
+			for (size_t e = 0; e < chain.Expiries(); e++) {
+				chain.Risk(e, callDelta.data(), putDelta.data(), gamma.data(), vega.data());
+			}
+			sink += gamma[0];
+		}
+		double chainRiskNs = chrono::duration<double, nano>(Clock::now() - start).count() / repeats / contracts;
+
+		start = Clock::now();
+		for (int k = 0; k < repeats; k++) {
+			chain.SetSpot(S + 0.01 * (k % 2));
+			for (size_t e = 0; e < chain.Expiries(); e++) {
+				chain.Price(e, call.data(), put.data());
+			}
+			sink += call[0];
+		}
+		double spotNs = chrono::duration<double, nano>(Clock::now() - start).count() / repeats / contracts;
+
+		cout << setprecision(4) << "ns per contract (" << contracts << " contracts, calls and puts)" << endl;
+		cout << "Price:    EuropeanOption " << objectNs << ", BatchPrice " << batchNs << ", OptionChain " << chainNs << endl;
+		cout << "Risk:     EuropeanOption " << objectRiskNs << " (Delta + Gamma + Vega), OptionChain " << chainRiskNs << " (both deltas, gamma, vega)" << endl;
+		cout << "SetSpot + reprice chain: " << spotNs << endl;
+		cout << "Speed-up of OptionChain over EuropeanOption: price " << objectNs / chainNs << "x, risk " << objectRiskNs / chainRiskNs << "x" << endl;
+		if (sink == 0.0) cout << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Chain.(a) ===
+Largest difference (price, delta, gamma, vega; calls and puts): 1.07e-13
+T = 0.5, K = 100: call 7.12992, put 6.14972
+T = 0.08, K = 69.6: put 4.32269e-11, EuropeanOption 4.32269e-11, relative difference 3.83e-14
+
+=== Chain.(b) ===
+After SetSpot(101.5) and SetVol(3, 0.30), largest difference: 1.06e-13
+T = 0.5, K = 100: call 9.62832, put 7.17045
+
+=== Chain.(c) ===
+ns per contract (800 contracts, calls and puts)
+Price:    EuropeanOption 298.5, BatchPrice 62.65, OptionChain 11.72
+Risk:     EuropeanOption 157.8 (Delta + Gamma + Vega), OptionChain 8.136 (both deltas, gamma, vega)
+SetSpot + reprice chain: 15.58
+Speed-up of OptionChain over EuropeanOption: price 25.48x, risk 19.4x
+*/
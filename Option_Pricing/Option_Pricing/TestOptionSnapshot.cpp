@@ -0,0 +1,179 @@
+#include "EuropeanOption.hpp"
+#include "OptionSnapshot.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <vector>
+
+typedef chrono::steady_clock Clock;
+
+// The writer moves S and K together (K = S + 5), so a reader that ever sees K != S + 5 has
+// read a half-updated option.
+const double RUN_SECONDS = 0.3;
+
+struct Result {
+	double m_readsPerSecond;
+	long long m_torn;
+	long long m_publications;
+};
+
+// Reader threads price as fast as they can while one writer publishes a new spot every
+// 50 microseconds; read(thread, sum, torn) performs one read.
+template <typename Read, typename Write>
+Result Contend(int readers, Read read, Write write) {
+	atomic<bool> stop(false);
+	vector<long long> reads(readers), torn(readers);
+	vector<double> sink(readers);
+	long long publications = 0;
+	vector<thread> workers;
+	Clock::time_point start = Clock::now();
+	for (int t = 0; t < readers; t++) {
+		workers.push_back(thread([&, t]() {
+			long long n = 0, bad = 0;
+			double sum = 0.0;
+			while (!stop.load(memory_order_relaxed)) {
+				read(t, sum, bad);
+				n++;
+			}
+			reads[t] = n;
+			torn[t] = bad;
+			sink[t] = sum;
+		}));
+	}
+	thread writer([&]() {
+		while (!stop.load(memory_order_relaxed)) {
+			write(100.0 + (publications % 100) * 0.01);
+			publications++;
+			this_thread::sleep_for(chrono::microseconds(50));
+		}
+	});
+	this_thread::sleep_for(chrono::duration<double>(RUN_SECONDS));
+	stop = true;
+	writer.join();
+	for (int t = 0; t < readers; t++) {
+		workers[t].join();
+	}
+	double seconds = chrono::duration<double>(Clock::now() - start).count();
+	Result result = { 0.0, 0, publications };
+	for (int t = 0; t < readers; t++) {
+		result.m_readsPerSecond += reads[t] / seconds;
+		result.m_torn += torn[t];
+	}
+	return result;
+}
+
+int main() {
+	try {
+		/* Immutable, thread-shareable option snapshots */
+
+		// a) snapshots price like EuropeanOption; Toggled() leaves the original alone
+		cout << "=== Snapshot.(a) ===" << endl;
+		EuropeanOptionData batch1(60, 65, 0.25, 0.08, 0.30, 0.08);
+		SnapshotPublisher publisher(batch1, Type::call);
+		shared_ptr<const OptionSnapshot> call = publisher.Load();
+		shared_ptr<const OptionSnapshot> put = call->Toggled();
+		EuropeanOption option(batch1);
+		cout << setprecision(10) << "Snapshot call " << call->Price() << ", EuropeanOption call " << option.Price() << endl;
+		option.toggle();
+		cout << "Snapshot put  " << put->Price() << ", EuropeanOption put  " << option.Price() << endl;
+		cout << "Original snapshot is still a " << ((call->GetType() == Type::call) ? "call" : "put") << ": " << call->Price() << endl;
+		publisher.Publish(EuropeanOptionData(61, 65, 0.25, 0.08, 0.30, 0.08), Type::call);
+		cout << "After Publish(S = 61): held snapshot S = " << call->GetData().m_S << ", current S = " << publisher.Load()->GetData().m_S
+			<< ", version " << publisher.Version() << endl;
+		cout << endl;
+
+		// b) readers under a writer: mutex-guarded shared option vs snapshots
+		cout << "=== Snapshot.(b) ===" << endl;
+		cout << setprecision(4) << "Readers\tMutex price/s\tMutex copy/s\tatomic_load/s\tReader/s\tTorn reads\tPublications" << endl;
+		for (int readers = 1; readers <= 4; readers *= 2) {
+			// shared EuropeanOption, priced under the lock
+			mutex m;
+			EuropeanOption shared(105, 110, 0.5, 0.05, 0.2, 0.05);
+			Result locked = Contend(readers,
+				[&](int, double& sum, long long& bad) {
+					lock_guard<mutex> lock(m);
+					sum += shared.Price();
+					bad += (shared.GetData().m_K != shared.GetData().m_S + 5.0);
+				},
+				[&](double S) {
+					EuropeanOption next(S, S + 5.0, 0.5, 0.05, 0.2, 0.05);
+					lock_guard<mutex> lock(m);
+					shared = next;
+				});
+
+			// shared EuropeanOption, copied under the lock and priced outside
+			Result copied = Contend(readers,
+				[&](int, double& sum, long long& bad) {
+					unique_lock<mutex> lock(m);
+					EuropeanOption local(shared);
+					lock.unlock();
+					sum += local.Price();
+					bad += (local.GetData().m_K != local.GetData().m_S + 5.0);
+				},
+				[&](double S) {
+					EuropeanOption next(S, S + 5.0, 0.5, 0.05, 0.2, 0.05);
+					lock_guard<mutex> lock(m);
+					shared = next;
+				});
+
+			// snapshots through atomic_load on every read
+			SnapshotPublisher market(EuropeanOptionData(105, 110, 0.5, 0.05, 0.2, 0.05), Type::call);
+			Result loaded = Contend(readers,
+				[&](int, double& sum, long long& bad) {
+					shared_ptr<const OptionSnapshot> s = market.Load();
+					sum += s->Price();
+					bad += (s->GetData().m_K != s->GetData().m_S + 5.0);
+				},
+				[&](double S) {
+					market.Publish(EuropeanOptionData(S, S + 5.0, 0.5, 0.05, 0.2, 0.05), Type::call);
+				});
+
+			// snapshots through a per-thread SnapshotReader
+			vector<unique_ptr<SnapshotReader>> views;
+			for (int t = 0; t < readers; t++) {
+				views.push_back(unique_ptr<SnapshotReader>(new SnapshotReader(market)));
+			}
+			Result viewed = Contend(readers,
+				[&](int t, double& sum, long long& bad) {
+					const OptionSnapshot& s = views[t]->Get();
+					sum += s.Price();
+					bad += (s.GetData().m_K != s.GetData().m_S + 5.0);
+				},
+				[&](double S) {
+					market.Publish(EuropeanOptionData(S, S + 5.0, 0.5, 0.05, 0.2, 0.05), Type::call);
+				});
+
+			cout << readers << "\t" << locked.m_readsPerSecond << "\t" << copied.m_readsPerSecond << "\t" << loaded.m_readsPerSecond << "\t"
+				<< viewed.m_readsPerSecond << "\t" << locked.m_torn + copied.m_torn + loaded.m_torn + viewed.m_torn << "\t\t"
+				<< locked.m_publications << "/" << copied.m_publications << "/" << loaded.m_publications << "/" << viewed.m_publications << endl;
+		}
+		cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+		shared_ptr<const OptionSnapshot> probe = make_shared<const OptionSnapshot>(batch1, Type::call);
+		cout << "atomic_load/atomic_store on shared_ptr lock-free: " << (atomic_is_lock_free(&probe) ? "yes" : "no") << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Snapshot.(a) ===
+Snapshot call 2.133368445, EuropeanOption call 2.133368445
+Snapshot put  5.84628221, EuropeanOption put  5.84628221
+Original snapshot is still a call: 2.133368445
+After Publish(S = 61): held snapshot S = 60, current S = 61, version 1
+
+=== Snapshot.(b) ===
+Readers	Mutex price/s	Mutex copy/s	atomic_load/s	Reader/s	Torn reads	Publications
+1	7.567e+06	7.998e+06	6.332e+06	8.395e+06	0		2484/2691/2620/2815
+2	7.921e+06	8.051e+06	6.424e+06	8.457e+06	0		2191/2428/2390/2485
+4	8.282e+06	7.856e+06	6.627e+06	8.23e+06	0		63/965/722/2167
+Hardware threads: 1
+atomic_load/atomic_store on shared_ptr lock-free: no
+*/
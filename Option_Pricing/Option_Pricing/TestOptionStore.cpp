@@ -0,0 +1,144 @@
+#include "OptionStore.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+typedef chrono::steady_clock Clock;
+
+int main() {
+	try {
+		/* Arena-backed compact option storage */
+
+		// a) handles give the same values as EuropeanOption
+		cout << "=== Store.(a) ===" << endl;
+		EuropeanOption option(105, 100, 0.5, 0.1, 0.36, 0);
+		OptionStore<double> store;
+		OptionStore<float> compact;
+		store.Add(option.GetData(), Type::call);
+		store.Add(option.GetData(), Type::put);
+		compact.Add(option.GetData(), Type::call);
+		compact.Add(option.GetData(), Type::put);
+		cout << "\tPrice\tDelta\tGamma    \tVega\tTheta" << endl;
+		for (int i = 0; i < 2; i++) {
+			EuropeanOption reference(option.GetData(), store[i].GetType());
+			cout << ((i == 0) ? "Call:\t" : "Put:\t") << reference.Price() << "\t" << reference.Delta() << "\t" << reference.Gamma() << "\t"
+				<< reference.Vega() << "\t" << reference.Theta() << endl;
+			cout << "double\t" << store[i].Price() << "\t" << store[i].Delta() << "\t" << store[i].Gamma() << "\t"
+				<< store[i].Vega() << "\t" << store[i].Theta() << endl;
+			cout << "float\t" << compact[i].Price() << "\t" << compact[i].Delta() << "\t" << compact[i].Gamma() << "\t"
+				<< compact[i].Vega() << "\t" << compact[i].Theta() << endl;
+		}
+		cout << endl;
+
+		// b) memory per contract and iteration throughput; EuropeanOption::Price() goes through
+		// the boost cdf, the BsPrice() row prices the same objects with the store's kernel
+		cout << "=== Store.(b) ===" << endl;
+		const int n = 2000000;
+		vector<EuropeanOptionData> data;
+		vector<Type> types;
+		data.reserve(n);
+		for (int i = 0; i < n; i++) {
+			data.push_back(EuropeanOptionData(60 + (i % 11), 50.0 + (i % 31), 0.1 + 0.05 * (i % 19), 0.08, 0.30, 0.08));
+			types.push_back((i % 2 == 0) ? Type::call : Type::put);
+		}
+
+		Clock::time_point start = Clock::now();
+		vector<EuropeanOption> objects;
+		for (int i = 0; i < n; i++) {
+			objects.push_back(EuropeanOption(data[i], types[i]));
+		}
+		double buildObjects = chrono::duration<double, milli>(Clock::now() - start).count();
+		start = Clock::now();
+		OptionStore<double> store64;
+		store64.Add(data, types);
+		double build64 = chrono::duration<double, milli>(Clock::now() - start).count();
+		start = Clock::now();
+		OptionStore<float> store32;
+		store32.Add(data, types);
+		double build32 = chrono::duration<double, milli>(Clock::now() - start).count();
+
+		double sum = 0.0;
+		start = Clock::now();
+		for (int i = 0; i < n; i++) {
+			sum += objects[i].Price();
+		}
+		double priceObjects = chrono::duration<double, milli>(Clock::now() - start).count();
+		// same erfc kernel as the store, so the difference to the store rows is the layout alone
+		start = Clock::now();
+		for (int i = 0; i < n; i++) {
+			const EuropeanOptionData& d = objects[i].GetData();
+			sum += BsPrice(d.m_S, d.m_K, d.m_T, d.m_r, d.m_sig, d.m_b, (objects[i].GetType() == Type::call) ? 1.0 : (-1.0));
+		}
+		double kernelObjects = chrono::duration<double, milli>(Clock::now() - start).count();
+		start = Clock::now();
+		vector<double> prices64 = store64.Price();
+		double price64 = chrono::duration<double, milli>(Clock::now() - start).count();
+		start = Clock::now();
+		vector<double> prices32 = store32.Price();
+		double price32 = chrono::duration<double, milli>(Clock::now() - start).count();
+
+		// plain traversal counting the calls: no math, so it measures the memory footprint
+		double calls = 0.0;
+		start = Clock::now();
+		for (int i = 0; i < n; i++) {
+			calls += (objects[i].GetType() == Type::call);
+		}
+		double scanObjects = chrono::duration<double, milli>(Clock::now() - start).count();
+		start = Clock::now();
+		for (int i = 0; i < n; i++) {
+			calls += (store64[i].GetType() == Type::call);
+		}
+		double scan64 = chrono::duration<double, milli>(Clock::now() - start).count();
+		start = Clock::now();
+		for (int i = 0; i < n; i++) {
+			calls += (store32[i].GetType() == Type::call);
+		}
+		double scan32 = chrono::duration<double, milli>(Clock::now() - start).count();
+
+		cout << "Storage\t\t\tBytes/contract\tBuild ms\tPrice ms\tScan ms" << endl;
+		cout << "vector<EuropeanOption>\t" << sizeof(EuropeanOption) << "\t\t" << setprecision(4) << buildObjects << "\t\t" << priceObjects << "\t\t" << scanObjects << endl;
+		cout << "  priced by BsPrice()\t\t\t\t" << kernelObjects << endl;
+		cout << "OptionStore<double>\t" << (double)store64.Bytes() / n << "\t\t" << build64 << "\t\t" << price64 << "\t\t" << scan64 << endl;
+		cout << "OptionStore<float>\t" << (double)store32.Bytes() / n << "\t\t" << build32 << "\t\t" << price32 << "\t\t" << scan32 << endl;
+
+		double err = 0.0;
+		for (int i = 0; i < n; i++) {
+			err = max(err, abs(prices32[i] - prices64[i]));
+		}
+		cout << "Max price difference float vs double mode: " << setprecision(2) << err << " (checksum " << sum + calls << ")" << endl;
+
+		// bulk release
+		start = Clock::now();
+		store64.Clear();
+		store32.Clear();
+		double release = chrono::duration<double, milli>(Clock::now() - start).count();
+		cout << "Bulk release of both stores: " << setprecision(4) << release << " ms" << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Store.(a) ===
+	Price	Delta	Gamma    	Vega	Theta
+Call:	12.4328	0.594629	0.0134936	26.7781	-8.39684
+double	12.4328	0.594629	0.0134936	26.7781	-8.39684
+float	12.4328	0.594629	0.0134936	26.7781	-8.39684
+Put:	7.6767	-0.356601	0.0134936	26.7781	1.11545
+double	7.6767	-0.356601	0.0134936	26.7781	1.11545
+float	7.6767	-0.356601	0.0134936	26.7781	1.11545
+
+=== Store.(b) ===
+Storage			Bytes/contract	Build ms	Price ms	Scan ms
+vector<EuropeanOption>	64		142.7		248.7		12.11
+  priced by BsPrice()				77.07
+OptionStore<double>	48.09		56.88		92.28		11.96
+OptionStore<float>	32.06		47.13		108.5		8.842
+Max price difference float vs double mode: 4.3e-07 (checksum 3e+07)
+Bulk release of both stores: 0.1584 ms
+*/
@@ -0,0 +1,116 @@
+#include "ParityScanner.hpp"
+#include "EuropeanOption.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+typedef chrono::steady_clock Clock;
+
+// chain of model prices (b = r, the case EuropeanOption::ISPutCallParity assumes) with a half-spread around each price
+OptionChainQuotes Chain(double S, double r, double sig, int expiries, int strikes, double halfSpread) {
+	OptionChainQuotes chain;
+	chain.m_S = S;
+	chain.m_r = r;
+	chain.m_b = r;
+	for (int e = 0; e < expiries; e++) {
+		double T = 0.25 * (e + 1);
+		for (int k = 0; k < strikes; k++) {
+			double K = S * (0.75 + 0.5 * k / strikes);
+			double call = EuropeanOption(S, K, T, r, sig, r, Type::call).Price();
+			double put = EuropeanOption(S, K, T, r, sig, r, Type::put).Price();
+			chain.Add(ParityQuote(K, T, call - halfSpread, call + halfSpread, put - halfSpread, put + halfSpread));
+		}
+	}
+	return chain;
+}
+
+int main() {
+	try {
+		/* Put-call parity scanner */
+
+		// a) batch 1 and batch 2 quotes from A.I.(b); a mispriced put is flagged
+		cout << "=== Parity.(a) ===" << endl;
+		OptionChainQuotes batch1;
+		batch1.m_S = 60; batch1.m_r = 0.08; batch1.m_b = 0.08;
+		batch1.Add(ParityQuote(65, 0.25, 2.13337, 5.84628));
+		batch1.Add(ParityQuote(65, 0.25, 2.13337, 5.94628));
+		OptionChainQuotes batch2;
+		batch2.m_S = 100; batch2.m_r = 0.0; batch2.m_b = 0.0;
+		batch2.Add(ParityQuote(100, 1.0, 7.96557, 7.96557));
+		ParityScanner exact(0.00001);
+		vector<OptionChainQuotes> chains;
+		chains.push_back(batch1);
+		chains.push_back(batch2);
+		vector<ParityViolation> found = exact.Scan(chains);
+		vector<double> residuals = exact.Residuals(batch1);
+		cout << "Batch 1 residuals: " << residuals[0] << ", " << residuals[1] << endl;
+		cout << "Violations: " << found.size() << endl;
+		for (size_t i = 0; i < found.size(); i++) {
+			cout << "  chain " << found[i].m_chain << ", quote " << found[i].m_quote << ", residual " << found[i].m_residual << endl;
+		}
+		cout << endl;
+
+		// b) bid/ask spread: a 0.03 mid-price break inside a 0.05 half-spread is not tradeable
+		cout << "=== Parity.(b) ===" << endl;
+		OptionChainQuotes quoted = Chain(100, 0.05, 0.2, 2, 5, 0.05);
+		quoted.m_putBid[3] += 0.03;
+		quoted.m_putAsk[3] += 0.03;
+		quoted.m_callBid[7] += 0.15;
+		quoted.m_callAsk[7] += 0.15;
+		cout << "Mid-price check: " << ParityScanner(0.01).Scan(quoted).size() << " violations" << endl;
+		cout << "Spread-aware check: " << ParityScanner(0.01, true, 1).Scan(quoted).size() << " violation(s)" << endl;
+		cout << endl;
+
+		// c) throughput
+		cout << "=== Parity.(c) ===" << endl;
+		vector<OptionChainQuotes> market;
+		for (int u = 0; u < 2000; u++) {
+			market.push_back(Chain(50.0 + u % 100, 0.05, 0.25, 8, 50, 0.02));
+		}
+		size_t quotes = 2000 * 8 * 50;
+		const int repeat = 20;
+		ParityScanner scanner(0.001, true, 0);
+		Clock::time_point start = Clock::now();
+		size_t flagged = 0;
+		for (int k = 0; k < repeat; k++) {
+			flagged += scanner.Scan(market).size();
+		}
+		double seconds = chrono::duration<double>(Clock::now() - start).count();
+		cout << "Chain scanner:   " << setprecision(3) << repeat * quotes / seconds << " quotes/s (" << flagged << " flagged)" << endl;
+
+		// the per-quote check it replaces, which reprices the call on every quote
+		start = Clock::now();
+		size_t failed = 0;
+		for (size_t u = 0; u < 200; u++) {
+			for (size_t i = 0; i < market[u].Size(); i++) {
+				ParityQuote q = market[u][i];
+				EuropeanOption call(market[u].m_S, q.m_K, q.m_T, market[u].m_r, 0.25, market[u].m_b);
+				failed += !call.ISPutCallParity(0.5 * (q.m_putBid + q.m_putAsk), 0.001);
+			}
+		}
+		seconds = chrono::duration<double>(Clock::now() - start).count();
+		cout << "ISPutCallParity: " << 200 * 8 * 50 / seconds << " quotes/s (" << failed << " flagged)" << endl;
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Parity.(a) ===
+Batch 1 residuals: 3.76494e-06, -0.0999962
+Violations: 1
+  chain 0, quote 1, residual -0.0999962
+
+=== Parity.(b) ===
+Mid-price check: 2 violations
+Spread-aware check: 1 violation(s)
+
+=== Parity.(c) ===
+Chain scanner:   1.21e+08 quotes/s (0 flagged)
+ISPutCallParity: 5.75e+06 quotes/s (0 flagged)
+*/
@@ -0,0 +1,143 @@
+#include "PricingCache.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <random>
+
+typedef chrono::steady_clock Clock;
+
+// request stream in which a fraction hitRate repeats one of a small set of hot contracts
+// and the rest are contracts never seen before
+vector<EuropeanOptionData> MakeStream(size_t n, double hitRate, const vector<EuropeanOptionData>& hot, unsigned seed) {
+	mt19937 gen(seed);
+	uniform_real_distribution<double> u(0.0, 1.0);
+	vector<EuropeanOptionData> stream;
+	for (size_t i = 0; i < n; i++) {
+		if (u(gen) < hitRate) {
+			stream.push_back(hot[gen() % hot.size()]);
+		}
+		else {
+			stream.push_back(EuropeanOptionData(80 + 40 * u(gen), 100, 0.1 + u(gen), 0.05, 0.1 + 0.4 * u(gen), 0.05));
+		}
+	}
+	return stream;
+}
+
+// requests per second over all threads, each thread walking its own stream
+double Throughput(PricingCache* cache, const vector<vector<EuropeanOptionData>>& streams) {
+	vector<thread> workers;
+	vector<double> sink(streams.size());
+	Clock::time_point start = Clock::now();
+	for (size_t t = 0; t < streams.size(); t++) {
+		workers.push_back(thread([cache, &streams, &sink, t]() {
+			double sum = 0.0;
+			for (size_t i = 0; i < streams[t].size(); i++) {
+				sum += (cache != 0) ? cache->Price(streams[t][i], Type::call) : EuropeanOption(streams[t][i], Type::call).Price();
+			}
+			sink[t] = sum;
+		}));
+	}
+	for (size_t t = 0; t < workers.size(); t++) {
+		workers[t].join();
+	}
+	double seconds = chrono::duration<double>(Clock::now() - start).count();
+	return streams.size() * streams[0].size() / seconds;
+}
+
+int main() {
+	try {
+		/* Concurrent memoizing cache */
+
+		// a) cached results are the direct results; counters and eviction
+		cout << "=== Cache.(a) ===" << endl;
+		PricingCache cache(1024, 8);
+		EuropeanOption batch1(60, 65, 0.25, 0.08, 0.30, 0.08);
+		Type put = Type::put;
+		AmericanOption perpetual(110, 100, 0.1, 0.1, 0.02, put);
+		cout << setprecision(10);
+		for (int i = 0; i < 2; i++) {
+			cout << "Price " << cache.Price(batch1) << " (" << batch1.Price() << "), Delta " << cache.Delta(batch1) << " (" << batch1.Delta()
+				<< "), American put " << cache.Price(perpetual) << " (" << perpetual.Price() << ")" << endl;
+		}
+		cout << "Hits " << cache.Hits() << ", misses " << cache.Misses() << ", size " << cache.Size() << endl;
+		EuropeanOptionData negativeZero(60, 65, 0.25, 0.08, 0.30, -0.0), positiveZero(60, 65, 0.25, 0.08, 0.30, 0.0);
+		cache.Price(negativeZero, Type::call);
+		cache.Price(positiveZero, Type::call);
+		cout << "b = -0.0 and b = 0.0: " << cache.Misses() - 3 << " new misses" << endl;
+		for (int i = 0; i < 5000; i++) {
+			cache.Price(EuropeanOptionData(50 + 0.01 * i, 65, 0.25, 0.08, 0.30, 0.08), Type::call);
+			cache.Price(batch1); // hot entry keeps its reference bit
+		}
+		long long before = cache.Misses();
+		cache.Price(batch1);
+		cout << "After 5000 cold inserts into 1024 slots: size " << cache.Size() << ", hot entry "
+			<< ((cache.Misses() == before) ? "still cached" : "evicted") << endl;
+		cout << endl;
+
+		// b) single-thread throughput by hit rate, hot set pre-warmed
+		cout << "=== Cache.(b) ===" << endl;
+		const size_t n = 400000;
+		vector<EuropeanOptionData> hot;
+		for (int i = 0; i < 1000; i++) {
+			hot.push_back(EuropeanOptionData(90 + 0.02 * i, 100, 0.5, 0.05, 0.2, 0.05));
+		}
+		double rates[] = { 0.0, 0.5, 0.9, 0.99 };
+		cout << setprecision(4) << "Hit rate\tUncached/s\tCached/s\tSpeedup\tMeasured hit rate" << endl;
+		for (int i = 0; i < 4; i++) {
+			vector<vector<EuropeanOptionData>> streams(1, MakeStream(n, rates[i], hot, 7));
+			PricingCache warm(100000, 16);
+			for (size_t j = 0; j < hot.size(); j++) warm.Price(hot[j], Type::call);
+			long long h0 = warm.Hits(), m0 = warm.Misses();
+			double direct = Throughput(0, streams);
+			double cached = Throughput(&warm, streams);
+			double measured = (double)(warm.Hits() - h0) / (warm.Hits() - h0 + warm.Misses() - m0);
+			cout << rates[i] << "\t\t" << direct << "\t" << cached << "\t" << cached / direct << "\t" << measured << endl;
+		}
+		cout << endl;
+
+		// c) thread scaling at 0% and 90% hit rate
+		cout << "=== Cache.(c) ===" << endl;
+		cout << "Threads\tHit rate\tUncached/s\tCached/s" << endl;
+		unsigned maxThreads = max(1u, thread::hardware_concurrency());
+		for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+			for (int i = 0; i < 4; i += 2) {
+				vector<vector<EuropeanOptionData>> streams;
+				for (unsigned t = 0; t < threads; t++) {
+					streams.push_back(MakeStream(n / threads, rates[i], hot, 11 + t));
+				}
+				PricingCache warm(100000, 16);
+				for (size_t j = 0; j < hot.size(); j++) warm.Price(hot[j], Type::call);
+				cout << threads << "\t" << rates[i] << "\t\t" << Throughput(0, streams) << "\t" << Throughput(&warm, streams) << endl;
+			}
+		}
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Cache.(a) ===
+Price 2.133368445 (2.133368445), Delta 0.372482798 (0.372482798), American put 3.031060383 (3.031060383)
+Price 2.133368445 (2.133368445), Delta 0.372482798 (0.372482798), American put 3.031060383 (3.031060383)
+Hits 3, misses 3, size 3
+b = -0.0 and b = 0.0: 2 new misses
+After 5000 cold inserts into 1024 slots: size 1024, hot entry still cached
+
+=== Cache.(b) ===
+Hit rate	Uncached/s	Cached/s	Speedup	Measured hit rate
+0		5.238e+06	2.254e+06	0.4302	0
+0.5		6.241e+06	3.836e+06	0.6146	0.4998
+0.9		7.085e+06	1.015e+07	1.433	0.8992
+0.99		7.229e+06	1.833e+07	2.535	0.9901
+
+=== Cache.(c) ===
+Threads	Hit rate	Uncached/s	Cached/s
+1	0		5.09e+06	2.208e+06
+1	0.9		6.482e+06	1.081e+07
+*/
@@ -0,0 +1,188 @@
+#include "PricingService.hpp"
+#include "PricingServer.hpp"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+typedef chrono::steady_clock Clock;
+
+// percentile of a latency sample, in microseconds
+double Percentile(vector<double>& sample, double p) {
+	size_t k = min(sample.size() - 1, (size_t)(p * sample.size()));
+	nth_element(sample.begin(), sample.begin() + k, sample.end());
+	return sample[k];
+}
+
+void Report(const string& name, int clients, vector<double>& latency, double seconds) {
+	cout << name << "\t" << clients << "\t"
+		<< setprecision(4) << Percentile(latency, 0.50) << "\t" << Percentile(latency, 0.99) << "\t" << Percentile(latency, 0.999) << "\t"
+		<< setprecision(3) << latency.size() / seconds << endl;
+}
+
+// each client thread c sends n single-option requests back to back through price(c, data, type)
+template <typename F>
+void Load(const string& name, int clients, int n, F price) {
+	vector<vector<double>> latency(clients, vector<double>(n));
+	vector<thread> threads;
+	Clock::time_point start = Clock::now();
+	for (int c = 0; c < clients; c++) {
+		threads.push_back(thread([&, c]() {
+			for (int i = 0; i < n; i++) {
+				EuropeanOptionData data(60 + (i % 7), 65, 0.25, 0.08, 0.30, 0.08);
+				Clock::time_point t0 = Clock::now();
+				price(c, data, (i % 2 == 0) ? Type::call : Type::put);
+				latency[c][i] = chrono::duration<double, micro>(Clock::now() - t0).count();
+			}
+		}));
+	}
+	for (int c = 0; c < clients; c++) {
+		threads[c].join();
+	}
+	double seconds = chrono::duration<double>(Clock::now() - start).count();
+	vector<double> all;
+	for (int c = 0; c < clients; c++) {
+		all.insert(all.end(), latency[c].begin(), latency[c].end());
+	}
+	Report(name, clients, all, seconds);
+}
+
+int main() {
+	try {
+		/* Request-coalescing asynchronous pricing service */
+
+		// a) the service returns the same prices as EuropeanOption::Price()
+		cout << "=== Service.(a) ===" << endl;
+		PricingService service(64, 20);
+		EuropeanOption batch1(60, 65, 0.25, 0.08, 0.30, 0.08);
+		EuropeanOption batch2(100, 100, 1.0, 0.0, 0.2, 0.0, Type::put);
+		future<double> f1 = service.Submit(batch1);
+		future<double> f2 = service.Submit(batch2);
+		cout << "Batch 1 call: service = " << f1.get() << ", Price() = " << batch1.Price() << endl;
+		cout << "Batch 2 put: service = " << f2.get() << ", Price() = " << batch2.Price() << endl;
+		cout << endl;
+
+		// b) latency (us) and throughput (requests/s) under closed-loop load
+		cout << "=== Service.(b) ===" << endl;
+		cout << "Mode\tClients\tp50\tp99\tp99.9\tReq/s" << endl;
+		const int n = 20000;
+		int clients[] = { 1, 4, 16 };
+		for (int i = 0; i < 3; i++) {
+			Load("Direct", clients[i], n, [](int, const EuropeanOptionData& data, const Type& type) {
+				return EuropeanOption(data, type).Price();
+			});
+			Load("Service", clients[i], n, [&service](int, const EuropeanOptionData& data, const Type& type) {
+				return service.Submit(data, type).get();
+			});
+		}
+		cout << "Average batch size: " << (double)service.Requests() / service.Batches() << endl;
+
+		// gateway threads that fan out a burst of requests before waiting let the service fill whole batches
+		{
+			long long batches = service.Batches(), requests = service.Requests();
+			vector<thread> threads;
+			Clock::time_point start = Clock::now();
+			for (int c = 0; c < 16; c++) {
+				threads.push_back(thread([&service, n]() {
+					vector<future<double>> burst;
+					for (int i = 0; i < n; i++) {
+						burst.push_back(service.Submit(EuropeanOptionData(60 + (i % 7), 65, 0.25, 0.08, 0.30, 0.08), (i % 2 == 0) ? Type::call : Type::put));
+						if (burst.size() == 64) {
+							for (size_t j = 0; j < burst.size(); j++) burst[j].get();
+							burst.clear();
+						}
+					}
+					for (size_t j = 0; j < burst.size(); j++) burst[j].get();
+				}));
+			}
+			for (int c = 0; c < 16; c++) {
+				threads[c].join();
+			}
+			double seconds = chrono::duration<double>(Clock::now() - start).count();
+			cout << "Burst of 64, 16 clients: " << setprecision(3) << 16.0 * n / seconds << " req/s, average batch size "
+				<< (double)(service.Requests() - requests) / (service.Batches() - batches) << endl;
+		}
+		cout << endl;
+
+		// c) loopback socket front end
+		cout << "=== Service.(c) ===" << endl << setprecision(6);
+		PricingServer server(service, 0);
+		{
+			PricingClient client(server.Port());
+			cout << "Batch 1 call over loopback = " << client.Price(batch1.GetData(), Type::call) << endl;
+		}
+		cout << "Mode\tClients\tp50\tp99\tp99.9\tReq/s" << endl;
+		for (int i = 0; i < 2; i++) {
+			vector<PricingClient*> connections;
+			for (int c = 0; c < clients[i]; c++) {
+				connections.push_back(new PricingClient(server.Port()));
+			}
+			Load("Socket", clients[i], n / 4, [&connections](int c, const EuropeanOptionData& data, const Type& type) {
+				return connections[c]->Price(data, type);
+			});
+			for (int c = 0; c < clients[i]; c++) {
+				delete connections[c];
+			}
+		}
+		// short-lived connections: each one is closed and reaped by the server, so none of them pile up
+		{
+			Clock::time_point start = Clock::now();
+			double sum = 0.0;
+			for (int c = 0; c < 4000; c++) {
+				PricingClient client(server.Port());
+				sum += client.Price(batch1.GetData(), Type::call);
+			}
+			double seconds = chrono::duration<double>(Clock::now() - start).count();
+			cout << "4000 one-request connections: " << setprecision(3) << 4000 / seconds << " connections/s, mean price " << setprecision(6) << sum / 4000 << endl;
+		}
+		{
+			PricingClient client(server.Port());
+			vector<EuropeanOptionData> data;
+			vector<Type> types;
+			for (int i = 0; i < 100000; i++) {
+				data.push_back(EuropeanOptionData(60 + (i % 7), 65, 0.25, 0.08, 0.30, 0.08));
+				types.push_back((i % 2 == 0) ? Type::call : Type::put);
+			}
+			Clock::time_point start = Clock::now();
+			vector<double> prices = client.Price(data, types);
+			double seconds = chrono::duration<double>(Clock::now() - start).count();
+			cout << "Pipelined socket throughput: " << setprecision(3) << prices.size() / seconds << " req/s" << endl;
+		}
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (exception & err) {
+		cout << "Error: " << err.what() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Service.(a) ===
+Batch 1 call: service = 2.13337, Price() = 2.13337
+Batch 2 put: service = 7.96557, Price() = 7.96557
+
+=== Service.(b) ===
+Mode	Clients	p50	p99	p99.9	Req/s
+Direct	1	0.161	0.227	0.306	4.53e+06
+Service	1	79.4	85.42	206.9	1.26e+04
+Direct	4	0.155	0.211	0.28	4.75e+06
+Service	4	81.33	92.28	233	4.84e+04
+Direct	16	0.126	0.183	0.281	5.84e+06
+Service	16	84.41	118.8	296.5	1.87e+05
+Average batch size: 7
+Burst of 64, 16 clients: 6.45e+05 req/s, average batch size 64
+
+=== Service.(c) ===
+Batch 1 call over loopback = 2.13337
+Mode	Clients	p50	p99	p99.9	Req/s
+Socket	1	88.74	101.2	158.7	1.13e+04
+Socket	4	108	177.9	560.5	3.56e+04
+4000 one-request connections: 7.7e+03 connections/s, mean price 2.13337
+Pipelined socket throughput: 1.6e+06 req/s
+*/
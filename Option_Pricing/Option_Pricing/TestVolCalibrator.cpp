@@ -0,0 +1,176 @@
+#include "VolCalibrator.hpp"
+#include "BatchPricer.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+
+typedef chrono::steady_clock Clock;
+
+// synthetic chain priced from known SVI smiles: OTM puts below the forward, OTM calls above
+vector<ExpiryQuotes> MakeChain(double S, double r, double b, const vector<double>& expiries, const vector<SVIParameters>& smiles) {
+	vector<ExpiryQuotes> chain;
+	for (size_t e = 0; e < expiries.size(); e++) {
+		ExpiryQuotes quotes;
+		quotes.m_T = expiries[e];
+		double F = S * exp(b * quotes.m_T);
+		vector<EuropeanOptionData> data;
+		for (int i = 0; i < 40; i++) {
+			double K = S * (0.6 + 0.02 * i);
+			quotes.m_K.push_back(K);
+			quotes.m_type.push_back((K < F) ? Type::put : Type::call);
+			data.push_back(EuropeanOptionData(S, K, quotes.m_T, r, smiles[e].Vol(log(K / F), quotes.m_T), b));
+		}
+		quotes.m_price = BatchPrice(data, quotes.m_type);
+		chain.push_back(quotes);
+	}
+	return chain;
+}
+
+int main() {
+	try {
+		/* SVI volatility calibration */
+
+		double expiryArray[] = { 0.08, 0.17, 0.25, 0.5, 0.75, 1.0, 1.5, 2.0 };
+		vector<double> expiries(expiryArray, expiryArray + 8);
+		vector<SVIParameters> truth;
+		for (size_t e = 0; e < expiries.size(); e++) {
+			double T = expiries[e];
+			truth.push_back(SVIParameters(0.03 * T, 0.08 * sqrt(T) + 0.02, -0.5 + 0.1 * T, 0.02 * T, 0.15 + 0.05 * T));
+		}
+		double S = 100, r = 0.03, b = 0.03;
+		vector<ExpiryQuotes> chain = MakeChain(S, r, b, expiries, truth);
+
+		// a) cold start: recovered parameters and price error
+		cout << "=== Calib.(a) ===" << endl;
+		VolCalibrator calibrator(S, r, b);
+		vector<CalibrationResult> cold = calibrator.Calibrate(chain);
+		cout << "T\ta\tb\trho\tm\tsigma\tIter\tRMSE" << endl;
+		for (size_t e = 0; e < cold.size(); e++) {
+			const SVIParameters& p = cold[e].m_params;
+			cout << setprecision(4) << expiries[e] << "\t" << p.m_a << "\t" << p.m_b << "\t" << p.m_rho << "\t" << p.m_m << "\t"
+				<< p.m_sigma << "\t" << cold[e].m_iterations << "\t" << setprecision(2) << cold[e].m_rmse << endl;
+		}
+		double worst = 0.0;
+		for (size_t e = 0; e < expiries.size(); e++) {
+			double F = S * exp(b * expiries[e]);
+			for (size_t i = 0; i < chain[e].m_K.size(); i++) {
+				double k = log(chain[e].m_K[i] / F);
+				worst = max(worst, abs(cold[e].m_params.Vol(k, expiries[e]) - truth[e].Vol(k, expiries[e])));
+			}
+		}
+		cout << "Largest implied vol error over the chain: " << worst << endl;
+		cout << endl;
+
+		// b) the market moves a little: warm start from the previous fit vs cold start
+		cout << "=== Calib.(b) ===" << endl;
+		vector<SVIParameters> moved = truth;
+		for (size_t e = 0; e < moved.size(); e++) {
+			moved[e].m_a *= 1.02;
+			moved[e].m_rho -= 0.01;
+		}
+		vector<ExpiryQuotes> next = MakeChain(100.5, r, b, expiries, moved);
+		const int repeats = 50;
+		int warmIterations = 0, coldIterations = 0;
+		double coldMs = 0.0, warmMs = 0.0;
+		for (int i = 0; i < repeats; i++) {
+			VolCalibrator fresh(100.5, r, b);
+			Clock::time_point start = Clock::now();
+			vector<CalibrationResult> res = fresh.Calibrate(next);
+			coldMs += chrono::duration<double, milli>(Clock::now() - start).count();
+			for (size_t e = 0; e < res.size(); e++) coldIterations += res[e].m_iterations;
+
+			// a live engine still holds the fit from before the move
+			VolCalibrator warm(S, r, b);
+			warm.Calibrate(chain);
+			warm.SetMarket(100.5, r, b);
+			start = Clock::now();
+			res = warm.Calibrate(next);
+			warmMs += chrono::duration<double, milli>(Clock::now() - start).count();
+			for (size_t e = 0; e < res.size(); e++) warmIterations += res[e].m_iterations;
+		}
+		coldMs /= repeats;
+		warmMs /= repeats;
+		cout << setprecision(4) << "Cold start: " << coldMs << " ms per surface, " << (double)coldIterations / repeats / expiries.size() << " iterations per expiry" << endl;
+		cout << "Warm start: " << warmMs << " ms per surface, " << (double)warmIterations / repeats / expiries.size() << " iterations per expiry" << endl;
+		cout << endl;
+
+		// c) thread scaling of a full surface calibration
+		cout << "=== Calib.(c) ===" << endl;
+		cout << "Threads\tms per surface" << endl;
+		for (int threads = 1; threads <= (int)thread::hardware_concurrency(); threads *= 2) {
+			Clock::time_point start = Clock::now();
+			for (int i = 0; i < repeats; i++) {
+				VolCalibrator fresh(100.5, r, b);
+				fresh.Threads(threads);
+				fresh.Calibrate(next);
+			}
+			cout << threads << "\t" << chrono::duration<double, milli>(Clock::now() - start).count() / repeats << endl;
+		}
+		cout << endl;
+
+		// d) the chain rolls: the warm start follows the expiry, and bad quotes throw on the calling thread
+		cout << "=== Calib.(d) ===" << endl;
+		VolCalibrator rolling(S, r, b);
+		rolling.Threads(4);
+		rolling.Calibrate(chain);
+		vector<double> rolled(expiries.begin() + 1, expiries.end());
+		rolled.push_back(3.0);
+		vector<SVIParameters> rolledTruth(truth.begin() + 1, truth.end());
+		rolledTruth.push_back(SVIParameters(0.09, 0.08 * sqrt(3.0) + 0.02, -0.2, 0.06, 0.3));
+		vector<CalibrationResult> res = rolling.Calibrate(MakeChain(S, r, b, rolled, rolledTruth));
+		cout << "T\tIter\tRMSE" << endl;
+		for (size_t e = 0; e < res.size(); e++) {
+			cout << setprecision(4) << rolled[e] << "\t" << res[e].m_iterations << "\t" << setprecision(2) << res[e].m_rmse << endl;
+		}
+		vector<ExpiryQuotes> bad = chain;
+		bad[3].m_K[7] = -bad[3].m_K[7];
+		try {
+			rolling.Calibrate(bad);
+		}
+		catch (ImproperOptionDataException & err) {
+			cout << "Negative strike: " << err.GetMessage() << " (caught by the caller)" << endl;
+		}
+	}
+	catch (ImproperOptionDataException & err) {
+		cout << err.GetMessage() << endl;
+	}
+	catch (...) {
+		cout << "Error: unknown error!" << endl;
+	}
+	return 0;
+}
+
+/*
+=== Calib.(a) ===
+T	a	b	rho	m	sigma	Iter	RMSE
+0.08	0.0024	0.04263	-0.492	0.0016	0.154	8	9.2e-11
+0.17	0.0051	0.05298	-0.483	0.0034	0.1585	7	6.9e-10
+0.25	0.0075	0.06	-0.475	0.005	0.1625	7	4.4e-10
+0.5	0.015	0.07657	-0.45	0.01	0.175	7	2.9e-10
+0.75	0.0225	0.08928	-0.425	0.015	0.1875	7	5.5e-10
+1	0.03	0.1	-0.4	0.02	0.2	7	1.5e-09
+1.5	0.045	0.118	-0.35	0.03	0.225	8	5.8e-11
+2	0.06	0.1331	-0.3	0.04	0.25	8	9.5e-10
+Largest implied vol error over the chain: 9e-10
+
+=== Calib.(b) ===
+Cold start: 0.4703 ms per surface, 7.625 iterations per expiry
+Warm start: 0.1982 ms per surface, 2.5 iterations per expiry
+
+=== Calib.(c) ===
+Threads	ms per surface
+1	0.4503
+
+=== Calib.(d) ===
+T	Iter	RMSE
+0.17	0	6.9e-10
+0.25	0	4.4e-10
+0.5	0	2.9e-10
+0.75	0	5.5e-10
+1	0	1.5e-09
+1.5	0	5.8e-11
+2	0	9.5e-10
+3	16	1.6e-10
+Negative strike: Error: improper option data! (caught by the caller)
+*/
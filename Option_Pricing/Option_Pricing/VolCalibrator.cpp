@@ -0,0 +1,195 @@
+#include "VolCalibrator.hpp"
+#include "BatchPricer.hpp"
+#include <cmath>
+#include <algorithm>
+#include <thread>
+
+double SVIParameters::Variance(double k) const {
+	double d = k - m_m;
+	return m_a + m_b * (m_rho * d + sqrt(d * d + m_sigma * m_sigma));
+}
+
+double SVIParameters::Vol(double k, double T) const {
+	return sqrt(Variance(k) / T);
+}
+
+// keep the smile admissible: b >= 0, |rho| < 1, sigma > 0 and a positive minimum variance
+static void project(SVIParameters& p) {
+	p.m_b = max(p.m_b, 0.0);
+	p.m_rho = min(max(p.m_rho, -0.999), 0.999);
+	p.m_sigma = max(p.m_sigma, 1e-4);
+	double floor = -p.m_b * p.m_sigma * sqrt(1.0 - p.m_rho * p.m_rho) + 1e-8;
+	p.m_a = max(p.m_a, floor);
+}
+
+// solve the 5x5 system A x = y by Gaussian elimination with partial pivoting
+static bool solve(double A[5][5], double y[5], double x[5]) {
+	for (int c = 0; c < 5; c++) {
+		int pivot = c;
+		for (int r = c + 1; r < 5; r++) {
+			if (abs(A[r][c]) > abs(A[pivot][c])) pivot = r;
+		}
+		if (abs(A[pivot][c]) < 1e-300) return false;
+		for (int j = 0; j < 5; j++) swap(A[c][j], A[pivot][j]);
+		swap(y[c], y[pivot]);
+		for (int r = c + 1; r < 5; r++) {
+			double f = A[r][c] / A[c][c];
+			for (int j = c; j < 5; j++) A[r][j] -= f * A[c][j];
+			y[r] -= f * y[c];
+		}
+	}
+	for (int c = 4; c >= 0; c--) {
+		double sum = y[c];
+		for (int j = c + 1; j < 5; j++) sum -= A[c][j] * x[j];
+		x[c] = sum / A[c][c];
+	}
+	return true;
+}
+
+double VolCalibrator::residuals(const ExpiryQuotes& quotes, const SVIParameters& p, vector<EuropeanOptionData>& data, vector<double>& res, vector<double>& vega) const {
+	size_t n = quotes.m_K.size();
+	double T = quotes.m_T;
+	double F = m_S * exp(m_b * T);
+	data.clear();
+	for (size_t i = 0; i < n; i++) {
+		data.push_back(EuropeanOptionData(m_S, quotes.m_K[i], T, m_r, p.Vol(log(quotes.m_K[i] / F), T), m_b));
+	}
+	res.resize(n);
+	vega.resize(n);
+	// one batched repricing (and vega) of the whole expiry per evaluation
+	BatchPrice(data.data(), quotes.m_type.data(), n, res.data());
+	BatchVega(data.data(), n, vega.data());
+	double cost = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		res[i] -= quotes.m_price[i];
+		cost += res[i] * res[i];
+	}
+	return cost;
+}
+
+CalibrationResult VolCalibrator::calibrate(const ExpiryQuotes& quotes, const CalibrationResult& start) const {
+	size_t n = quotes.m_K.size();
+	double T = quotes.m_T;
+	double F = m_S * exp(m_b * T);
+	vector<EuropeanOptionData> data, trialData;
+	vector<double> res, vega, trialRes, trialVega;
+
+	CalibrationResult result;
+	result.m_params = start.m_params;
+	project(result.m_params);
+	result.m_iterations = 0;
+	SVIParameters& p = result.m_params;
+	double cost = residuals(quotes, p, data, res, vega);
+	// resume at the damping the last fit of this expiry ended with, but never more damped than a cold start
+	double& lambda = result.m_lambda;
+	lambda = min(start.m_lambda, 1e-3);
+	double target = m_priceTol * m_priceTol * n;
+
+	while (result.m_iterations < m_maxIterations && cost > target) {
+		// normal equations J'J and J'r with J = vega * dsig/dw * dw/dtheta
+		double JtJ[5][5] = { { 0 } }, Jtr[5] = { 0 };
+		for (size_t i = 0; i < n; i++) {
+			double k = log(quotes.m_K[i] / F);
+			double d = k - p.m_m;
+			double s = sqrt(d * d + p.m_sigma * p.m_sigma);
+			double sig = data[i].m_sig;
+			double dPdw = vega[i] / (2.0 * sig * T);
+			double J[5] = { dPdw, dPdw * (p.m_rho * d + s), dPdw * p.m_b * d, dPdw * p.m_b * (-p.m_rho - d / s), dPdw * p.m_b * p.m_sigma / s };
+			for (int a = 0; a < 5; a++) {
+				Jtr[a] += J[a] * res[i];
+				for (int b = 0; b < 5; b++) JtJ[a][b] += J[a] * J[b];
+			}
+		}
+
+		bool accepted = false;
+		while (!accepted && result.m_iterations < m_maxIterations && lambda < 1e12) {
+			result.m_iterations++;
+			double A[5][5], y[5], step[5];
+			for (int a = 0; a < 5; a++) {
+				for (int b = 0; b < 5; b++) A[a][b] = JtJ[a][b];
+				A[a][a] += lambda * JtJ[a][a] + 1e-14;
+				y[a] = -Jtr[a];
+			}
+			if (!solve(A, y, step)) {
+				lambda *= 4.0;
+				continue;
+			}
+			SVIParameters trial(p.m_a + step[0], p.m_b + step[1], p.m_rho + step[2], p.m_m + step[3], p.m_sigma + step[4]);
+			project(trial);
+			double trialCost = residuals(quotes, trial, trialData, trialRes, trialVega);
+			if (trialCost < cost) {
+				accepted = true;
+				bool converged = (cost - trialCost) <= m_tol * cost || trialCost <= target;
+				p = trial;
+				cost = trialCost;
+				data.swap(trialData);
+				res.swap(trialRes);
+				vega.swap(trialVega);
+				lambda = max(lambda / 3.0, 1e-12);
+				if (converged) {
+					result.m_rmse = sqrt(cost / n);
+					return result;
+				}
+			}
+			else {
+				lambda *= 4.0;
+			}
+		}
+		if (!accepted) break; // no further decrease possible
+	}
+	result.m_rmse = sqrt(cost / n);
+	return result;
+}
+
+vector<CalibrationResult> VolCalibrator::Calibrate(const vector<ExpiryQuotes>& chain) {
+	// validate up front: an exception thrown inside a worker thread could not be caught by the caller
+	for (size_t e = 0; e < chain.size(); e++) {
+		const ExpiryQuotes& q = chain[e];
+		if ((q.m_type.size() != q.m_K.size()) || (q.m_price.size() != q.m_K.size())) {
+			throw ImproperOptionDataException();
+		}
+		for (size_t i = 0; i < q.m_K.size(); i++) {
+			EuropeanOptionData(m_S, q.m_K[i], q.m_T, m_r, 0.2, m_b); // throws on S, K or T <= 0
+		}
+	}
+
+	vector<CalibrationResult> start(chain.size());
+	for (size_t e = 0; e < chain.size(); e++) {
+		map<double, CalibrationResult>::const_iterator previous = m_previous.find(chain[e].m_T);
+		if (previous != m_previous.end()) {
+			start[e] = previous->second;
+		}
+		else { // cold start: 20% vol at k = m with the default skew (rho = -0.3) and wings
+			start[e].m_params.m_a = 0.04 * chain[e].m_T - start[e].m_params.m_b * start[e].m_params.m_sigma;
+			start[e].m_lambda = 1e-3;
+		}
+	}
+
+	vector<CalibrationResult> results(chain.size());
+	size_t threads = (m_threads > 0) ? m_threads : max(1u, thread::hardware_concurrency());
+	threads = max((size_t)1, min(threads, chain.size()));
+	if (threads == 1) {
+		for (size_t e = 0; e < chain.size(); e++) {
+			results[e] = calibrate(chain[e], start[e]);
+		}
+	}
+	else {
+		vector<thread> workers;
+		for (size_t t = 0; t < threads; t++) {
+			// expiries are independent; interleave them so long and short ones are spread evenly
+			workers.push_back(thread([this, &chain, &start, &results, t, threads]() {
+				for (size_t e = t; e < chain.size(); e += threads) {
+					results[e] = calibrate(chain[e], start[e]);
+				}
+			}));
+		}
+		for (size_t t = 0; t < threads; t++) {
+			workers[t].join();
+		}
+	}
+
+	for (size_t e = 0; e < chain.size(); e++) {
+		m_previous[chain[e].m_T] = results[e];
+	}
+	return results;
+}
@@ -0,0 +1,68 @@
+#ifndef VolCalibrator_HPP
+#define VolCalibrator_HPP
+
+#include <vector>
+#include <map>
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+// raw SVI smile of one expiry, in total implied variance w = sig^2 T as a function of
+// log-moneyness k = log(K / F): w(k) = a + b (rho (k - m) + sqrt((k - m)^2 + sigma^2))
+struct SVIParameters {
+	double m_a;
+	double m_b;
+	double m_rho;
+	double m_m;
+	double m_sigma;
+	SVIParameters() : m_a(0.02), m_b(0.1), m_rho(-0.3), m_m(0.0), m_sigma(0.1) {};
+	SVIParameters(double a, double b, double rho, double m, double sigma) : m_a(a), m_b(b), m_rho(rho), m_m(m), m_sigma(sigma) {};
+	double Variance(double k) const;
+	double Vol(double k, double T) const;
+};
+
+// quotes of one expiry
+struct ExpiryQuotes {
+	double m_T;				// exercise (maturity) date
+	vector<double> m_K;		// strikes
+	vector<Type> m_type;	// option type of each quote
+	vector<double> m_price;	// quoted prices
+};
+
+struct CalibrationResult {
+	SVIParameters m_params;
+	int m_iterations;		// Levenberg-Marquardt iterations (accepted and rejected steps)
+	double m_rmse;			// root mean square price error
+	double m_lambda;		// final Levenberg-Marquardt damping, where a warm start resumes
+};
+
+// Fits one SVI smile per expiry to option prices by Levenberg-Marquardt. The Jacobian uses the
+// analytic vega: dPrice/dtheta = Vega * dsig/dw * dw/dtheta. Every iteration reprices the whole
+// expiry with one BatchPrice()/BatchVega() call, independent expiries are calibrated in
+// parallel, and each calibration warm-starts from the previous fit of the same expiry T,
+// parameters and damping both.
+class VolCalibrator {
+private:
+	double m_S;		// asset price
+	double m_r;		// risk-free interest rate
+	double m_b;		// cost of carry
+	int m_maxIterations;
+	double m_tol;		// relative decrease of the squared error below which the fit stops
+	double m_priceTol;	// root mean square price error below which the fit stops
+	int m_threads;		// 0: use hardware concurrency
+	map<double, CalibrationResult> m_previous;	// last fit by expiry T, the warm start
+
+	CalibrationResult calibrate(const ExpiryQuotes& quotes, const CalibrationResult& start) const;
+	double residuals(const ExpiryQuotes& quotes, const SVIParameters& p, vector<EuropeanOptionData>& data, vector<double>& res, vector<double>& vega) const;
+public:
+	VolCalibrator(double S, double r, double b) : m_S(S), m_r(r), m_b(b), m_maxIterations(100), m_tol(1e-10), m_priceTol(1e-8), m_threads(0) {};
+	virtual ~VolCalibrator() {};
+
+	void SetMarket(double S, double r, double b) { m_S = S; m_r = r; m_b = b; };
+	void Threads(int threads) { m_threads = threads; };
+	void Reset() { m_previous.clear(); };	// forget the warm start
+
+	vector<CalibrationResult> Calibrate(const vector<ExpiryQuotes>& chain);
+};
+
+#endif